@@ -134,3 +134,89 @@ def require_foreign(namespace, symbol=None):
     except Exception as e:
         raise ImportError(str(e))
     importlib.import_module('gi.repository', namespace)
+
+
+def enable_array_buffers(namespace, enable=True):
+    """Return C arrays of numbers as buffers instead of lists.
+
+    Arrays of numbers (other than guint8, which are returned as bytes)
+    that functions of the namespace return with full transfer are wrapped
+    in a :class:`gi._gi.ArrayBuffer` owning the memory instead of being
+    converted to a list. The buffer can be consumed without copying, for
+    example with ``memoryview()`` or ``numpy.frombuffer()``.
+
+    :param str namespace:
+        Introspection namespace (e.g. "GIMarshallingTests")
+    :param bool enable:
+        False to go back to returning lists.
+
+    :Example:
+
+    .. code-block:: python
+
+        import gi
+        gi.enable_array_buffers('Regress')
+
+    """
+    _gi.enable_array_buffers(namespace, enable)
+
+
+def set_gil_policy(function, policy):
+    """Set whether the GIL is released while calling a function.
+
+    By default the GIL is released around every call, so other Python
+    threads can run while it blocks. It is kept for methods which look
+    like cheap accessors: named get_*, is_* or has_*, taking no arguments
+    other than the instance and not throwing errors. For those, releasing
+    and taking back the GIL costs more than the call itself.
+
+    :param function:
+        Introspected function or method (e.g. Gtk.Widget.get_visible).
+    :param policy:
+        "keep", "release" or None to go back to the default.
+    :raises: ValueError for an unknown policy
+
+    Keeping the GIL around a function that blocks until another Python
+    thread did something will deadlock.
+
+    :Example:
+
+    .. code-block:: python
+
+        import gi
+        gi.set_gil_policy(Gtk.TreeModel.iter_next, 'keep')
+
+    """
+    _gi.set_gil_policy(function, policy)
+
+
+def get_gil_policy(function):
+    """Return "keep" or "release", see :func:`set_gil_policy`."""
+    return _gi.get_gil_policy(function)
+
+
+def warm_up(namespace, names=()):
+    """Prepare a namespace for fast attribute access.
+
+    Builds an index of all names in the namespace, so later lookups of
+    attributes not yet used are a hash lookup instead of a typelib search,
+    and creates the wrappers for the given names up front.
+
+    :param str namespace:
+        Introspection namespace (e.g. "Gtk")
+    :param names:
+        Names of classes, functions and constants to wrap right away.
+    :raises: AttributeError if one of the names does not exist
+
+    :Example:
+
+    .. code-block:: python
+
+        import gi
+        gi.warm_up('Gtk', ['Window', 'Box', 'Button', 'Label'])
+
+    """
+    module = importlib.import_module('gi.repository.' + namespace)
+    _gi.Repository.get_default().build_index(namespace)
+    for name in names:
+        getattr(module, name)
@@ -48,6 +48,12 @@ else:
     _long = long
 
 
+# Property types which can be kept in native storage
+_NATIVE_STORAGE_TYPES = (TYPE_BOOLEAN, TYPE_CHAR, TYPE_UCHAR, TYPE_INT,
+                         TYPE_UINT, TYPE_LONG, TYPE_ULONG, TYPE_INT64,
+                         TYPE_UINT64, TYPE_FLOAT, TYPE_DOUBLE, TYPE_STRING)
+
+
 class Property(object):
     """Creates a new Property which when used in conjunction with
     GObject subclass will create a Python property accessor for the
@@ -346,6 +352,17 @@ class Property(object):
     def _default_getter(self, instance):
         return getattr(instance, '_property_helper_' + self.name, self.default)
 
+    def _enable_native_storage(self):
+        # called once the GType stores the value natively
+        self.fget = self._native_getter
+        self.fset = self._native_setter
+
+    def _native_setter(self, instance, value):
+        _gobject._property_native_set(instance, self.name, value)
+
+    def _native_getter(self, instance):
+        return _gobject._property_native_get(instance, self.name)
+
     def _readonly_setter(self, instance, value):
         self._exc = TypeError("%s property of %s is read-only" % (
             self.name, type(instance).__name__))
@@ -354,6 +371,15 @@ class Property(object):
         self._exc = TypeError("%s property of %s is write-only" % (
             self.name, type(instance).__name__))
 
+    def _can_use_native_storage(self):
+        """Whether the value can be kept in C storage attached to the instance,
+        so GObject can access it without calling back into Python."""
+        if self.fget != self._default_getter or self.fset != self._default_setter:
+            return False
+        ptype = self.type
+        return (ptype in _NATIVE_STORAGE_TYPES or
+                ptype.is_a(TYPE_ENUM) or ptype.is_a(TYPE_FLAGS))
+
     #
     # Public API
     #
@@ -383,6 +409,8 @@ def install_properties(cls):
     into the classes __gproperties__ dict if it exists or adds it if not.
     """
     gproperties = cls.__dict__.get('__gproperties__', {})
+    custom_accessors = ('do_get_property' in cls.__dict__ or
+                        'do_set_property' in cls.__dict__)
 
     props = []
     for name, prop in cls.__dict__.items():
@@ -402,11 +430,14 @@ def install_properties(cls):
             props.append(prop)
 
     if not props:
+        if custom_accessors:
+            # inherited properties must go through the custom accessors
+            cls.__gproperties_native__ = None
         return
 
     cls.__gproperties__ = gproperties
 
-    if 'do_get_property' in cls.__dict__ or 'do_set_property' in cls.__dict__:
+    if custom_accessors:
         for prop in props:
             if prop.fget != prop._default_getter or prop.fset != prop._default_setter:
                 raise TypeError(
@@ -415,6 +446,11 @@ def install_properties(cls):
                     " or getter. This is not allowed" %
                     (cls.__name__,))
 
+    # Properties with the default getter and setter of a basic type can be
+    # stored natively, type registration enables it for these.
+    cls.__gproperties_native__ = tuple(
+        prop for prop in props if prop._can_use_native_storage())
+
     def obj_get_property(self, pspec):
         name = pspec.name.replace('-', '_')
         return getattr(self, name, None)
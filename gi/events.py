@@ -0,0 +1,235 @@
+# -*- Mode: Python; py-indent-offset: 4 -*-
+# vim: tabstop=4 shiftwidth=4 expandtab
+#
+#   events.py: asyncio event loop running on a GLib.MainContext
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
+# USA
+
+"""PEP 3156 (asyncio) event loop backed by a GLib.MainContext.
+
+asyncio and GLib share a single poll: file descriptors are watched with
+g_source_add_unix_fd(), timers and call_soon() callbacks become the ready
+time of a single GSource, which runs all pending asyncio callbacks in one
+dispatch. Running either the asyncio loop or a GLib.MainLoop/Gtk.main()
+on the same context services both.
+
+    import asyncio
+    from gi.events import GLibEventLoopPolicy
+
+    asyncio.set_event_loop_policy(GLibEventLoopPolicy())
+
+Only available on Unix with Python 3.5.2 or newer, older asyncio versions
+lack loop.create_future() and stop the loop by raising from a callback.
+"""
+
+from __future__ import absolute_import
+
+import sys
+
+if sys.version_info < (3, 5, 2):
+    raise ImportError('gi.events requires Python 3.5.2 or newer')
+
+import asyncio
+import selectors
+import threading
+
+from gi.repository import GLib
+
+__all__ = ['GLibEventLoop', 'GLibEventLoopPolicy']
+
+# Python 3.5.3+, older versions have no running loop to set
+_get_running_loop = getattr(asyncio.events, '_get_running_loop', None)
+_set_running_loop = getattr(asyncio.events, '_set_running_loop', None)
+
+
+class _Source(GLib.Source):
+    """Runs one iteration of the asyncio loop when dispatched.
+
+    prepare() and check() are left to GLib.Source, GLib dispatches the
+    source on its own when a watched fd is ready or the ready time passed.
+    """
+
+    def __init__(self, loop):
+        super(_Source, self).__init__()
+        self._loop = loop
+
+    def dispatch(self, callback, args):
+        self._loop._dispatch()
+        return True
+
+
+class _Selector(selectors._BaseSelectorImpl):
+    """Selector which adds its file descriptors to a GSource.
+
+    select() never blocks, it reports the conditions GLib polled for the
+    source and is only called while the source is dispatched.
+    """
+
+    def __init__(self, source):
+        super(_Selector, self).__init__()
+        self._source = source
+        self._tags = {}
+
+    @staticmethod
+    def _condition_from_events(events):
+        condition = 0
+        if events & selectors.EVENT_READ:
+            condition |= GLib.IOCondition.IN
+        if events & selectors.EVENT_WRITE:
+            condition |= GLib.IOCondition.OUT
+        return condition
+
+    def register(self, fileobj, events, data=None):
+        key = super(_Selector, self).register(fileobj, events, data)
+        self._tags[key.fd] = self._source.add_unix_fd(
+            key.fd, self._condition_from_events(events))
+        return key
+
+    def unregister(self, fileobj):
+        key = super(_Selector, self).unregister(fileobj)
+        self._source.remove_unix_fd(self._tags.pop(key.fd))
+        return key
+
+    def modify(self, fileobj, events, data=None):
+        key = self.get_key(fileobj)
+        if events == key.events:
+            return super(_Selector, self).modify(fileobj, events, data)
+
+        key = key._replace(events=events, data=data)
+        self._fd_to_key[key.fd] = key
+        self._source.modify_unix_fd(self._tags[key.fd],
+                                    self._condition_from_events(events))
+        return key
+
+    def select(self, timeout=None):
+        ready = []
+        for fd, tag in self._tags.items():
+            condition = self._source.query_unix_fd(tag)
+            if not condition:
+                continue
+
+            events = 0
+            if condition & (GLib.IOCondition.IN | GLib.IOCondition.HUP |
+                            GLib.IOCondition.ERR):
+                events |= selectors.EVENT_READ
+            if condition & (GLib.IOCondition.OUT | GLib.IOCondition.HUP |
+                            GLib.IOCondition.ERR):
+                events |= selectors.EVENT_WRITE
+
+            key = self._fd_to_key[fd]
+            if events & key.events:
+                ready.append((key, events & key.events))
+        return ready
+
+    def close(self):
+        for tag in self._tags.values():
+            self._source.remove_unix_fd(tag)
+        self._tags.clear()
+        super(_Selector, self).close()
+
+
+class GLibEventLoop(asyncio.SelectorEventLoop):
+    """asyncio event loop which runs on the given GLib.MainContext, the
+    global default context if None.
+
+    The loop's source stays attached to the context until the loop is
+    closed, so asyncio callbacks also run while the context is iterated
+    by GLib, e.g. from Gtk.main().
+    """
+
+    def __init__(self, main_context=None):
+        if main_context is None:
+            main_context = GLib.MainContext.default()
+
+        self._context = main_context
+        self._ready_time = -1
+        self._source = _Source(self)
+        super(GLibEventLoop, self).__init__(_Selector(self._source))
+        self._source.attach(main_context)
+        self._update_ready_time()
+
+    def get_context(self):
+        return self._context
+
+    def time(self):
+        # timers are ready times of the source, use the same clock
+        return GLib.get_monotonic_time() / 1000000.0
+
+    def _set_ready_time(self, ready_time):
+        if ready_time != self._ready_time:
+            self._ready_time = ready_time
+            self._source.set_ready_time(ready_time)
+
+    def _update_ready_time(self):
+        if self._ready or getattr(self, '_stopping', False):
+            self._set_ready_time(0)
+        elif self._scheduled:
+            self._set_ready_time(int(self._scheduled[0]._when * 1000000))
+        else:
+            self._set_ready_time(-1)
+
+    def _run_once(self):
+        # Called by run_forever(), let GLib poll and dispatch. The asyncio
+        # callbacks run from _Source.dispatch() along with other sources.
+        self._context.iteration(True)
+
+    def _dispatch(self):
+        if self.is_running() or _set_running_loop is None:
+            super(GLibEventLoop, self)._run_once()
+        else:
+            # GLib iterates the context, e.g. from Gtk.main(). Make this the
+            # running loop so coroutines calling get_running_loop() work.
+            running_loop = _get_running_loop()
+            _set_running_loop(self)
+            try:
+                super(GLibEventLoop, self)._run_once()
+            finally:
+                _set_running_loop(running_loop)
+        self._update_ready_time()
+
+    def _call_soon(self, *args, **kwargs):
+        handle = super(GLibEventLoop, self)._call_soon(*args, **kwargs)
+        self._set_ready_time(0)
+        return handle
+
+    def call_at(self, when, callback, *args, **kwargs):
+        handle = super(GLibEventLoop, self).call_at(when, callback, *args, **kwargs)
+        self._update_ready_time()
+        return handle
+
+    def stop(self):
+        super(GLibEventLoop, self).stop()
+        self._set_ready_time(0)
+
+    def close(self):
+        if self.is_closed():
+            return
+        super(GLibEventLoop, self).close()
+        self._source.destroy()
+        self._source._loop = None
+
+
+class GLibEventLoopPolicy(asyncio.DefaultEventLoopPolicy):
+    """Event loop policy creating GLibEventLoop instances.
+
+    The loop of the main thread runs on the global default GLib.MainContext,
+    loops of other threads on a new context each.
+    """
+
+    def new_event_loop(self):
+        if threading.current_thread() is threading.main_thread():
+            return GLibEventLoop(GLib.MainContext.default())
+        return GLibEventLoop(GLib.MainContext())
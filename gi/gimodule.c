@@ -29,6 +29,10 @@
 #include "pyglib.h"
 #include "pygi-error.h"
 #include "pygi-foreign.h"
+#include "pygi-array.h"
+#include "pygi-variant.h"
+#include "pygi-tree-model.h"
+#include "pygi-async.h"
 
 #include <pyglib-python-compat.h>
 
@@ -305,6 +309,38 @@ _wrap_pyg_register_interface_info (PyObject *self, PyObject *args)
     Py_RETURN_NONE;
 }
 
+static PyObject *
+_wrap_pyg_setup_lazy_members (PyObject *args, PyGILazyMemberKind kind,
+                              const char *format)
+{
+    PyObject *py_type;
+    PyGIBaseInfo *py_info;
+
+    if (!PyArg_ParseTuple (args, format,
+                           &PyType_Type, &py_type,
+                           &PyGIBaseInfo_Type, &py_info))
+        return NULL;
+
+    if (_pygi_info_setup_lazy_members (py_type, (PyObject *) py_info, kind) < 0)
+        return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+_wrap_pyg_setup_lazy_methods (PyObject *self, PyObject *args)
+{
+    return _wrap_pyg_setup_lazy_members (args, PYGI_LAZY_MEMBER_METHOD,
+                                         "O!O!:setup_lazy_methods");
+}
+
+static PyObject *
+_wrap_pyg_setup_lazy_constants (PyObject *self, PyObject *args)
+{
+    return _wrap_pyg_setup_lazy_members (args, PYGI_LAZY_MEMBER_CONSTANT,
+                                         "O!O!:setup_lazy_constants");
+}
+
 static void
 find_vfunc_info (GIBaseInfo *vfunc_info,
                  GType implementor_gtype,
@@ -507,6 +543,95 @@ _wrap_pyg_variant_new_tuple (PyObject *self, PyObject *args)
     return py_variant;
 }
 
+/* Sinks @variant and wraps it in a GLib.Variant, which drops the reference
+ * again in its __del__ override. */
+static PyObject *
+_wrap_variant_sink (GVariant *variant)
+{
+    PyObject *py_type;
+    PyObject *py_variant;
+
+    if (variant == NULL)
+        return NULL;
+
+    g_variant_ref_sink (variant);
+
+    py_type = _pygi_type_import_by_name ("GLib", "Variant");
+    if (py_type == NULL) {
+        g_variant_unref (variant);
+        return NULL;
+    }
+
+    py_variant = _pygi_struct_new ( (PyTypeObject *) py_type, variant, FALSE);
+    Py_DECREF (py_type);
+    if (py_variant == NULL)
+        g_variant_unref (variant);
+
+    return py_variant;
+}
+
+static PyObject *
+_wrap_pyg_variant_new (PyObject *self, PyObject *args)
+{
+    char *format_string;
+    PyObject *py_value;
+
+    if (!PyArg_ParseTuple (args, "sO:variant_new",
+                           &format_string, &py_value)) {
+        return NULL;
+    }
+
+    return _wrap_variant_sink (pygi_variant_new (format_string, py_value));
+}
+
+static PyObject *
+_wrap_pyg_variant_new_from_buffer (PyObject *self, PyObject *args)
+{
+    char *type_string;
+    PyObject *py_buffer;
+
+    if (!PyArg_ParseTuple (args, "sO:variant_new_from_buffer",
+                           &type_string, &py_buffer)) {
+        return NULL;
+    }
+
+    return _wrap_variant_sink (pygi_variant_new_from_buffer (type_string, py_buffer));
+}
+
+static PyObject *
+_wrap_pyg_variant_to_buffer (PyObject *self, PyObject *args)
+{
+    PyObject *py_variant;
+
+    if (!PyArg_ParseTuple (args, "O:variant_to_buffer", &py_variant)) {
+        return NULL;
+    }
+
+    if (!pyg_pointer_check (py_variant, G_TYPE_VARIANT)) {
+        PyErr_SetString (PyExc_TypeError, "argument is not a GLib.Variant");
+        return NULL;
+    }
+
+    return pygi_variant_to_buffer (pyg_pointer_get (py_variant, GVariant));
+}
+
+static PyObject *
+_wrap_pyg_variant_unpack (PyObject *self, PyObject *args)
+{
+    PyObject *py_variant;
+
+    if (!PyArg_ParseTuple (args, "O:variant_unpack", &py_variant)) {
+        return NULL;
+    }
+
+    if (!pyg_pointer_check (py_variant, G_TYPE_VARIANT)) {
+        PyErr_SetString (PyExc_TypeError, "argument is not a GLib.Variant");
+        return NULL;
+    }
+
+    return pygi_variant_unpack (pyg_pointer_get (py_variant, GVariant));
+}
+
 static PyObject *
 _wrap_pyg_variant_type_from_string (PyObject *self, PyObject *args)
 {
@@ -530,6 +655,89 @@ _wrap_pyg_variant_type_from_string (PyObject *self, PyObject *args)
     return py_variant;
 }
 
+static PyObject *
+_wrap_pyg_enable_array_buffers (PyObject *self, PyObject *args)
+{
+    char *namespace_;
+    int enable = TRUE;
+
+    if (!PyArg_ParseTuple (args, "s|i:enable_array_buffers",
+                           &namespace_, &enable)) {
+        return NULL;
+    }
+
+    pygi_array_buffers_enable (namespace_, enable);
+
+    Py_RETURN_NONE;
+}
+
+/* Returns the unbound version of @py_info which owns the function cache. */
+static PyGIBaseInfo *
+_get_unbound_function_info (PyGICallableInfo *py_info)
+{
+    if (py_info->py_unbound_info != NULL)
+        return (PyGIBaseInfo *) py_info->py_unbound_info;
+    return (PyGIBaseInfo *) py_info;
+}
+
+static PyObject *
+_wrap_pyg_set_gil_policy (PyObject *self, PyObject *args)
+{
+    PyGICallableInfo *py_info;
+    PyGIBaseInfo *unbound;
+    const char *policy_str = NULL;
+    PyGIGILPolicy policy;
+
+    if (!PyArg_ParseTuple (args, "O!z:set_gil_policy",
+                           &PyGIFunctionInfo_Type, &py_info, &policy_str)) {
+        return NULL;
+    }
+
+    if (policy_str == NULL) {
+        policy = PYGI_GIL_POLICY_DEFAULT;
+    } else if (strcmp (policy_str, "keep") == 0) {
+        policy = PYGI_GIL_POLICY_KEEP;
+    } else if (strcmp (policy_str, "release") == 0) {
+        policy = PYGI_GIL_POLICY_RELEASE;
+    } else {
+        PyErr_Format (PyExc_ValueError,
+                      "GIL policy must be 'keep', 'release' or None, not '%s'",
+                      policy_str);
+        return NULL;
+    }
+
+    unbound = _get_unbound_function_info (py_info);
+    pygi_function_info_set_gil_policy ((GIFunctionInfo *) unbound->info, policy);
+
+    if (unbound->cache != NULL) {
+        ((PyGIFunctionCache *) unbound->cache)->keep_gil =
+            pygi_function_info_keeps_gil ((GIFunctionInfo *) unbound->info);
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+_wrap_pyg_get_gil_policy (PyObject *self, PyObject *args)
+{
+    PyGICallableInfo *py_info;
+    PyGIBaseInfo *unbound;
+    gboolean keep_gil;
+
+    if (!PyArg_ParseTuple (args, "O!:get_gil_policy",
+                           &PyGIFunctionInfo_Type, &py_info)) {
+        return NULL;
+    }
+
+    unbound = _get_unbound_function_info (py_info);
+    if (unbound->cache != NULL)
+        keep_gil = ((PyGIFunctionCache *) unbound->cache)->keep_gil;
+    else
+        keep_gil = pygi_function_info_keeps_gil ((GIFunctionInfo *) unbound->info);
+
+    return PYGLIB_PyUnicode_FromString (keep_gil ? "keep" : "release");
+}
+
 static PyObject *
 _wrap_pyg_source_new (PyObject *self, PyObject *args)
 {
@@ -617,12 +825,27 @@ static PyMethodDef _gi_functions[] = {
 
     { "register_interface_info", (PyCFunction) _wrap_pyg_register_interface_info, METH_VARARGS },
     { "hook_up_vfunc_implementation", (PyCFunction) _wrap_pyg_hook_up_vfunc_implementation, METH_VARARGS },
+    { "setup_lazy_methods", (PyCFunction) _wrap_pyg_setup_lazy_methods, METH_VARARGS },
+    { "setup_lazy_constants", (PyCFunction) _wrap_pyg_setup_lazy_constants, METH_VARARGS },
     { "variant_new_tuple", (PyCFunction) _wrap_pyg_variant_new_tuple, METH_VARARGS },
+    { "variant_new", (PyCFunction) _wrap_pyg_variant_new, METH_VARARGS },
+    { "variant_unpack", (PyCFunction) _wrap_pyg_variant_unpack, METH_VARARGS },
+    { "variant_new_from_buffer", (PyCFunction) _wrap_pyg_variant_new_from_buffer, METH_VARARGS },
+    { "variant_to_buffer", (PyCFunction) _wrap_pyg_variant_to_buffer, METH_VARARGS },
+    { "store_insert_row", (PyCFunction) _wrap_pygi_store_insert_row, METH_VARARGS },
+    { "store_extend", (PyCFunction) _wrap_pygi_store_extend, METH_VARARGS },
+    { "tree_model_get_values", (PyCFunction) _wrap_pygi_tree_model_get_values, METH_VARARGS },
+    { "tree_model_get_rows", (PyCFunction) _wrap_pygi_tree_model_get_rows, METH_VARARGS },
+    { "store_set_values", (PyCFunction) _wrap_pygi_store_set_values, METH_VARARGS },
     { "variant_type_from_string", (PyCFunction) _wrap_pyg_variant_type_from_string, METH_VARARGS },
     { "source_new", (PyCFunction) _wrap_pyg_source_new, METH_NOARGS },
     { "source_set_callback", (PyCFunction) pyg_source_set_callback, METH_VARARGS },
+    { "source_setup_methods", (PyCFunction) pyg_source_setup_methods, METH_VARARGS },
     { "io_channel_read", (PyCFunction) pyg_channel_read, METH_VARARGS },
     { "require_foreign", (PyCFunction) pygi_require_foreign, METH_VARARGS | METH_KEYWORDS },
+    { "enable_array_buffers", (PyCFunction) _wrap_pyg_enable_array_buffers, METH_VARARGS },
+    { "set_gil_policy", (PyCFunction) _wrap_pyg_set_gil_policy, METH_VARARGS },
+    { "get_gil_policy", (PyCFunction) _wrap_pyg_get_gil_policy, METH_VARARGS },
     { NULL, NULL, 0 }
 };
 
@@ -675,6 +898,8 @@ PYGLIB_MODULE_START(_gi, "_gi")
     _pygi_struct_register_types (module);
     _pygi_boxed_register_types (module);
     _pygi_ccallback_register_types (module);
+    _pygi_array_register_types (module);
+    pygi_async_register_types (module);
     _pygi_argument_init ();
 
     /* Use RuntimeWarning as the base class of PyGIDeprecationWarning
@@ -155,6 +155,61 @@ pyg_type_is_a (PyObject *self, PyObject *args)
     return PyBool_FromLong(g_type_is_a(type, parent));
 }
 
+/* Properties declared with GObject.Property using the default getter and
+ * setter for a basic type keep their value in a GValue attached to the
+ * instance, so GObject can get and set them without calling into Python.
+ * Each such pspec carries the quark its value is stored under. */
+static GQuark
+pyg_property_storage_quark (GObject *object, GParamSpec *pspec)
+{
+    /* a Python subclass providing its own do_get/set_property must still
+     * see all property accesses */
+    if (g_type_get_qdata(G_OBJECT_TYPE(object),
+                         pygobject_custom_property_accessors_key))
+        return 0;
+
+    return GPOINTER_TO_UINT(g_param_spec_get_qdata(pspec,
+                                                   pygobject_property_storage_key));
+}
+
+static void
+pyg_property_storage_free (gpointer data)
+{
+    GValue *stored = data;
+
+    g_value_unset(stored);
+    g_slice_free(GValue, stored);
+}
+
+static void
+pyg_property_storage_set (GObject *object, GQuark storage,
+                          const GValue *value)
+{
+    GValue *stored;
+
+    stored = g_object_get_qdata(object, storage);
+    if (!stored) {
+        stored = g_slice_new0(GValue);
+        g_value_init(stored, G_VALUE_TYPE(value));
+        g_object_set_qdata_full(object, storage, stored,
+                                pyg_property_storage_free);
+    }
+    g_value_copy(value, stored);
+}
+
+static void
+pyg_property_storage_get (GObject *object, GQuark storage,
+                          GParamSpec *pspec, GValue *value)
+{
+    GValue *stored;
+
+    stored = g_object_get_qdata(object, storage);
+    if (stored)
+        g_value_copy(stored, value);
+    else
+        g_param_value_set_default(pspec, value);
+}
+
 static void
 pyg_object_set_property (GObject *object, guint property_id,
 			 const GValue *value, GParamSpec *pspec)
@@ -162,6 +217,13 @@ pyg_object_set_property (GObject *object, guint property_id,
     PyObject *object_wrapper, *retval;
     PyObject *py_pspec, *py_value;
     PyGILState_STATE state;
+    GQuark storage;
+
+    storage = pyg_property_storage_quark(object, pspec);
+    if (storage) {
+        pyg_property_storage_set(object, storage, value);
+        return;
+    }
 
     state = pyglib_gil_state_ensure();
 
@@ -196,6 +258,13 @@ pyg_object_get_property (GObject *object, guint property_id,
 {
     PyObject *object_wrapper, *retval;
     PyGILState_STATE state;
+    GQuark storage;
+
+    storage = pyg_property_storage_quark(object, pspec);
+    if (storage) {
+        pyg_property_storage_get(object, storage, pspec, value);
+        return;
+    }
 
     state = pyglib_gil_state_ensure();
 
@@ -800,11 +869,69 @@ add_properties (GObjectClass *klass, PyObject *properties)
     return ret;
 }
 
+/* Sets up native storage for the GObject.Property instances of @class
+ * listed in the __gproperties_native__ tuple. None means the class
+ * implements do_get/set_property itself, in which case native storage
+ * is disabled for it and its subclasses. */
+static gboolean
+add_native_properties (GObjectClass *class, PyObject *native)
+{
+    GType gtype = G_OBJECT_CLASS_TYPE(class);
+    Py_ssize_t i;
+
+    if (native == Py_None ||
+        g_type_get_qdata(g_type_parent(gtype),
+                         pygobject_custom_property_accessors_key)) {
+        g_type_set_qdata(gtype, pygobject_custom_property_accessors_key,
+                         GINT_TO_POINTER(TRUE));
+        return TRUE;
+    }
+
+    if (native == NULL || !PyTuple_Check(native))
+        return TRUE;
+
+    for (i = 0; i < PyTuple_GET_SIZE(native); i++) {
+        PyObject *prop = PyTuple_GET_ITEM(native, i);
+        PyObject *py_name, *retval;
+        const char *name;
+        GParamSpec *pspec;
+        gchar *storage_name;
+
+        py_name = PyObject_GetAttrString(prop, "name");
+        if (py_name == NULL)
+            return FALSE;
+        name = PYGLIB_PyUnicode_AsString(py_name);
+        if (name == NULL) {
+            Py_DECREF(py_name);
+            return FALSE;
+        }
+
+        pspec = g_object_class_find_property(class, name);
+        Py_DECREF(py_name);
+        if (pspec == NULL || pspec->owner_type != gtype)
+            continue;
+
+        storage_name = g_strdup_printf("PyGObject::property-value::%s::%s",
+                                       g_type_name(gtype), pspec->name);
+        g_param_spec_set_qdata(pspec, pygobject_property_storage_key,
+                               GUINT_TO_POINTER(g_quark_from_string(storage_name)));
+        g_free(storage_name);
+
+        retval = PyObject_CallMethod(prop, "_enable_native_storage", NULL);
+        if (retval == NULL)
+            return FALSE;
+        Py_DECREF(retval);
+    }
+
+    return TRUE;
+}
+
 static void
 pyg_object_class_init(GObjectClass *class, PyObject *py_class)
 {
     PyObject *gproperties, *gsignals, *overridden_signals;
     PyObject *class_dict = ((PyTypeObject*) py_class)->tp_dict;
+    PyObject *native;
 
     class->set_property = pyg_object_set_property;
     class->get_property = pyg_object_get_property;
@@ -846,11 +973,20 @@ pyg_object_class_init(GObjectClass *class, PyObject *py_class)
 	if (!add_properties(class, gproperties)) {
 	    return;
 	}
+	pygobject_props_cache_invalidate(G_OBJECT_CLASS_TYPE(class));
 	PyDict_DelItemString(class_dict, "__gproperties__");
 	/* Borrowed reference. Py_DECREF(gproperties); */
     } else {
 	PyErr_Clear();
     }
+
+    native = PyDict_GetItemString(class_dict, "__gproperties_native__");
+    if (!add_native_properties(class, native)) {
+	return;
+    }
+    if (native) {
+	PyDict_DelItemString(class_dict, "__gproperties_native__");
+    }
 }
 
 static void
@@ -1597,6 +1733,102 @@ pyg__gvalue_set(PyObject *module, PyObject *args)
     Py_RETURN_NONE;
 }
 
+static GQuark
+pyg_find_property_storage (PyGObject *self, const char *name,
+                           GParamSpec **pspec)
+{
+    GQuark storage = 0;
+
+    if (self->obj != NULL) {
+        *pspec = g_object_class_find_property(G_OBJECT_GET_CLASS(self->obj), name);
+    } else {
+        /* GObject.__init__ did not run yet, look at the class instead */
+        GType g_type = pyg_type_from_object((PyObject *) Py_TYPE(self));
+        GObjectClass *klass;
+
+        if (!g_type)
+            return 0;
+        klass = g_type_class_ref(g_type);
+        *pspec = g_object_class_find_property(klass, name);
+        g_type_class_unref(klass);
+    }
+    if (*pspec)
+        storage = GPOINTER_TO_UINT(g_param_spec_get_qdata(*pspec,
+                                                          pygobject_property_storage_key));
+    if (!storage)
+        PyErr_Format(PyExc_TypeError,
+                     "property '%s' does not use native storage", name);
+    return storage;
+}
+
+static PyObject *
+pyg__property_native_get(PyObject *module, PyObject *args)
+{
+    PyGObject *self;
+    const char *name;
+    GParamSpec *pspec;
+    GQuark storage;
+    GValue value = { 0, };
+    PyObject *ret;
+
+    if (!PyArg_ParseTuple (args, "O!s:_gobject._property_native_get",
+                           &PyGObject_Type, &self, &name))
+        return NULL;
+
+    storage = pyg_find_property_storage(self, name, &pspec);
+    if (!storage)
+        return NULL;
+
+    g_value_init(&value, G_PARAM_SPEC_VALUE_TYPE(pspec));
+    if (self->obj == NULL)
+        g_value_copy(g_param_spec_get_default_value(pspec), &value);
+    else
+        pyg_property_storage_get(self->obj, storage, pspec, &value);
+    ret = pyg_param_gvalue_as_pyobject(&value, TRUE, pspec);
+    g_value_unset(&value);
+
+    return ret;
+}
+
+static PyObject *
+pyg__property_native_set(PyObject *module, PyObject *args)
+{
+    PyGObject *self;
+    const char *name;
+    PyObject *py_value;
+    GParamSpec *pspec;
+    GQuark storage;
+    GValue value = { 0, };
+
+    if (!PyArg_ParseTuple (args, "O!sO:_gobject._property_native_set",
+                           &PyGObject_Type, &self, &name, &py_value))
+        return NULL;
+
+    if (self->obj == NULL) {
+        PyErr_Format(PyExc_TypeError,
+                     "object at %p of type %s is not initialized",
+                     self, Py_TYPE(self)->tp_name);
+        return NULL;
+    }
+
+    storage = pyg_find_property_storage(self, name, &pspec);
+    if (!storage)
+        return NULL;
+
+    g_value_init(&value, G_PARAM_SPEC_VALUE_TYPE(pspec));
+    if (pyg_param_gvalue_from_pyobject(&value, py_value, pspec) < 0) {
+        g_value_unset(&value);
+        if (!PyErr_Occurred())
+            PyErr_Format(PyExc_TypeError,
+                         "could not convert value for property '%s'", name);
+        return NULL;
+    }
+    pyg_property_storage_set(self->obj, storage, &value);
+    g_value_unset(&value);
+
+    Py_RETURN_NONE;
+}
+
 static PyMethodDef _gobject_functions[] = {
     { "type_name", pyg_type_name, METH_VARARGS },
     { "type_from_name", pyg_type_from_name, METH_VARARGS },
@@ -1617,6 +1849,10 @@ static PyMethodDef _gobject_functions[] = {
       (PyCFunction)pyg__gvalue_get, METH_O },
     { "_gvalue_set",
       (PyCFunction)pyg__gvalue_set, METH_VARARGS },
+    { "_property_native_get",
+      (PyCFunction)pyg__property_native_get, METH_VARARGS },
+    { "_property_native_set",
+      (PyCFunction)pyg__property_native_set, METH_VARARGS },
 
     { NULL, NULL, 0 }
 };
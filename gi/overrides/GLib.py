@@ -19,13 +19,18 @@
 # Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301
 # USA
 
+import collections
 import signal
+import threading
 import warnings
+import weakref
 import sys
 
 from ..module import get_introspection_module
-from .._gi import (variant_new_tuple, variant_type_from_string, source_new,
-                   source_set_callback, io_channel_read)
+from .._gi import (variant_new, variant_new_tuple, variant_unpack,
+                   variant_new_from_buffer, variant_to_buffer,
+                   variant_type_from_string, source_new,
+                   source_set_callback, source_setup_methods, io_channel_read)
 from ..overrides import override, deprecated
 from gi import PyGIDeprecationWarning, version_info
 
@@ -81,148 +86,6 @@ __all__ += ['GError', 'Error', 'OptionContext', 'OptionGroup', 'Pid',
             'spawn_async', 'threads_init']
 
 
-class _VariantCreator(object):
-
-    _LEAF_CONSTRUCTORS = {
-        'b': GLib.Variant.new_boolean,
-        'y': GLib.Variant.new_byte,
-        'n': GLib.Variant.new_int16,
-        'q': GLib.Variant.new_uint16,
-        'i': GLib.Variant.new_int32,
-        'u': GLib.Variant.new_uint32,
-        'x': GLib.Variant.new_int64,
-        't': GLib.Variant.new_uint64,
-        'h': GLib.Variant.new_handle,
-        'd': GLib.Variant.new_double,
-        's': GLib.Variant.new_string,
-        'o': GLib.Variant.new_object_path,
-        'g': GLib.Variant.new_signature,
-        'v': GLib.Variant.new_variant,
-    }
-
-    def _create(self, format, args):
-        """Create a GVariant object from given format and argument list.
-
-        This method recursively calls itself for complex structures (arrays,
-        dictionaries, boxed).
-
-        Return a tuple (variant, rest_format, rest_args) with the generated
-        GVariant, the remainder of the format string, and the remainder of the
-        arguments.
-
-        If args is None, then this won't actually consume any arguments, and
-        just parse the format string and generate empty GVariant structures.
-        This is required for creating empty dictionaries or arrays.
-        """
-        # leaves (simple types)
-        constructor = self._LEAF_CONSTRUCTORS.get(format[0])
-        if constructor:
-            if args is not None:
-                if not args:
-                    raise TypeError('not enough arguments for GVariant format string')
-                v = constructor(args[0])
-                return (v, format[1:], args[1:])
-            else:
-                return (None, format[1:], None)
-
-        if format[0] == '(':
-            return self._create_tuple(format, args)
-
-        if format.startswith('a{'):
-            return self._create_dict(format, args)
-
-        if format[0] == 'a':
-            return self._create_array(format, args)
-
-        raise NotImplementedError('cannot handle GVariant type ' + format)
-
-    def _create_tuple(self, format, args):
-        """Handle the case where the outermost type of format is a tuple."""
-
-        format = format[1:]  # eat the '('
-        if args is None:
-            # empty value: we need to call _create() to parse the subtype
-            rest_format = format
-            while rest_format:
-                if rest_format.startswith(')'):
-                    break
-                rest_format = self._create(rest_format, None)[1]
-            else:
-                raise TypeError('tuple type string not closed with )')
-
-            rest_format = rest_format[1:]  # eat the )
-            return (None, rest_format, None)
-        else:
-            if not args or not isinstance(args[0], tuple):
-                raise TypeError('expected tuple argument')
-
-            builder = GLib.VariantBuilder.new(variant_type_from_string('r'))
-            for i in range(len(args[0])):
-                if format.startswith(')'):
-                    raise TypeError('too many arguments for tuple signature')
-
-                (v, format, _) = self._create(format, args[0][i:])
-                builder.add_value(v)
-            args = args[1:]
-            if not format.startswith(')'):
-                raise TypeError('tuple type string not closed with )')
-
-            rest_format = format[1:]  # eat the )
-            return (builder.end(), rest_format, args)
-
-    def _create_dict(self, format, args):
-        """Handle the case where the outermost type of format is a dict."""
-
-        builder = None
-        if args is None or not args[0]:
-            # empty value: we need to call _create() to parse the subtype,
-            # and specify the element type precisely
-            rest_format = self._create(format[2:], None)[1]
-            rest_format = self._create(rest_format, None)[1]
-            if not rest_format.startswith('}'):
-                raise TypeError('dictionary type string not closed with }')
-            rest_format = rest_format[1:]  # eat the }
-            element_type = format[:len(format) - len(rest_format)]
-            builder = GLib.VariantBuilder.new(variant_type_from_string(element_type))
-        else:
-            builder = GLib.VariantBuilder.new(variant_type_from_string('a{?*}'))
-            for k, v in args[0].items():
-                (key_v, rest_format, _) = self._create(format[2:], [k])
-                (val_v, rest_format, _) = self._create(rest_format, [v])
-
-                if not rest_format.startswith('}'):
-                    raise TypeError('dictionary type string not closed with }')
-                rest_format = rest_format[1:]  # eat the }
-
-                entry = GLib.VariantBuilder.new(variant_type_from_string('{?*}'))
-                entry.add_value(key_v)
-                entry.add_value(val_v)
-                builder.add_value(entry.end())
-
-        if args is not None:
-            args = args[1:]
-        return (builder.end(), rest_format, args)
-
-    def _create_array(self, format, args):
-        """Handle the case where the outermost type of format is an array."""
-
-        builder = None
-        if args is None or not args[0]:
-            # empty value: we need to call _create() to parse the subtype,
-            # and specify the element type precisely
-            rest_format = self._create(format[1:], None)[1]
-            element_type = format[:len(format) - len(rest_format)]
-            builder = GLib.VariantBuilder.new(variant_type_from_string(element_type))
-        else:
-            builder = GLib.VariantBuilder.new(variant_type_from_string('a*'))
-            for i in range(len(args[0])):
-                (v, rest_format, _) = self._create(format[1:], args[0][i:])
-                builder.add_value(v)
-        if args is not None:
-            args = args[1:]
-        return (builder.end(), rest_format, args)
-
-
 class Variant(GLib.Variant):
     def __new__(cls, format_string, value):
         """Create a GVariant from a native Python object.
@@ -236,10 +99,23 @@ class Variant(GLib.Variant):
           GLib.Variant('(asa{sv})', ([], {'foo': GLib.Variant('b', True),
                                           'bar': GLib.Variant('i', 2)}))
         """
-        creator = _VariantCreator()
-        (v, rest_format, _) = creator._create(format_string, [value])
-        if rest_format:
-            raise TypeError('invalid remaining format string: "%s"' % rest_format)
+        v = variant_new(format_string, value)
+        v.format_string = format_string
+        return v
+
+    @staticmethod
+    def new_from_buffer(format_string, buffer):
+        """Create an array GVariant of fixed width numbers from a buffer.
+
+        format_string is an array type like 'ay', 'ai' or 'ad' and buffer any
+        object supporting the buffer protocol holding the elements in native
+        byte order. The memory is used directly, without copying, so it must
+        not be modified while the GVariant is alive.
+
+        Example:
+          GLib.Variant.new_from_buffer('ad', struct.pack('=2d', 1.0, 2.0))
+        """
+        v = variant_new_from_buffer(format_string, buffer)
         v.format_string = format_string
         return v
 
@@ -277,56 +153,17 @@ class Variant(GLib.Variant):
     def unpack(self):
         """Decompose a GVariant into a native Python object."""
 
-        LEAF_ACCESSORS = {
-            'b': self.get_boolean,
-            'y': self.get_byte,
-            'n': self.get_int16,
-            'q': self.get_uint16,
-            'i': self.get_int32,
-            'u': self.get_uint32,
-            'x': self.get_int64,
-            't': self.get_uint64,
-            'h': self.get_handle,
-            'd': self.get_double,
-            's': self.get_string,
-            'o': self.get_string,  # object path
-            'g': self.get_string,  # signature
-        }
-
-        # simple values
-        la = LEAF_ACCESSORS.get(self.get_type_string())
-        if la:
-            return la()
-
-        # tuple
-        if self.get_type_string().startswith('('):
-            res = [self.get_child_value(i).unpack()
-                   for i in range(self.n_children())]
-            return tuple(res)
-
-        # dictionary
-        if self.get_type_string().startswith('a{'):
-            res = {}
-            for i in range(self.n_children()):
-                v = self.get_child_value(i)
-                res[v.get_child_value(0).unpack()] = v.get_child_value(1).unpack()
-            return res
-
-        # array
-        if self.get_type_string().startswith('a'):
-            return [self.get_child_value(i).unpack()
-                    for i in range(self.n_children())]
-
-        # variant (just unbox transparently)
-        if self.get_type_string().startswith('v'):
-            return self.get_variant().unpack()
+        return variant_unpack(self)
 
-        # maybe
-        if self.get_type_string().startswith('m'):
-            m = self.get_maybe()
-            return m.unpack() if m else None
+    def get_buffer(self):
+        """Return the elements of a fixed width numeric array as a buffer.
 
-        raise NotImplementedError('unsupported GVariant type ' + self.get_type_string())
+        Works for array types like 'ay', 'ai' or 'ad'. The returned read-only
+        gi._gi.ArrayBuffer shares the memory of the GVariant and keeps it
+        alive, e.g. memoryview(v.get_buffer()) or numpy.frombuffer() can be
+        used on it without copying.
+        """
+        return variant_to_buffer(self)
 
     @classmethod
     def split_signature(klass, signature):
@@ -575,6 +412,20 @@ class Source(GLib.Source):
     def __init__(self, *args, **kwargs):
         return super(Source, self).__init__()
 
+    # Default implementations for sources created with source_new(). As
+    # long as a subclass does not override them they are not called at all,
+    # the main loop then skips these phases without entering Python.
+    def prepare(self):
+        return False
+
+    def check(self):
+        return False
+
+    def attach(self, context=None):
+        if hasattr(self, '__pygi_custom_source'):
+            source_setup_methods(self)
+        return super(Source, self).attach(context)
+
     def set_callback(self, fn, user_data=None):
         if hasattr(self, '__pygi_custom_source'):
             # use our custom pyg_source_set_callback() if for a GSource object
@@ -661,6 +512,110 @@ def timeout_add_seconds(interval, function, *user_data, **kwargs):
 __all__.append('timeout_add_seconds')
 
 
+class _CallQueueSource(Source):
+    def __init__(self, queue):
+        super(_CallQueueSource, self).__init__()
+        self._queue = weakref.ref(queue)
+
+    def dispatch(self, callback, args):
+        queue = self._queue()
+        if queue is None:
+            return False
+        queue._dispatch()
+        return True
+
+
+class CallQueue(object):
+    """Runs callbacks posted from any thread in the given GLib.MainContext,
+    the global default context if None.
+
+    Unlike idle_add(), which creates a new source for each call, all calls
+    share a single source that is woken up once and then runs every call
+    queued so far in one dispatch. Posting does not take the context lock
+    unless the source has to be woken up.
+
+    With call_coalesced() only the latest call posted for a key runs,
+    repeated updates for the same target collapse into one.
+
+    The return value of callbacks is ignored. Pending calls are dropped
+    when the queue is closed or garbage collected, posting to a closed
+    queue raises RuntimeError.
+    """
+
+    def __init__(self, context=None, priority=GLib.PRIORITY_DEFAULT_IDLE):
+        self._calls = collections.deque()
+        self._coalesced = {}
+        self._lock = threading.Lock()
+        self._scheduled = False
+        self._closed = False
+
+        self._source = _CallQueueSource(self)
+        self._source.set_priority(priority)
+        self._source.attach(context)
+
+    def _check_closed(self):
+        if self._closed:
+            raise RuntimeError('CallQueue is closed')
+
+    def call(self, callback, *args):
+        self._check_closed()
+        self._calls.append((None, callback, args))
+        if not self._scheduled:
+            self._wakeup()
+
+    def call_coalesced(self, key, callback, *args):
+        self._check_closed()
+        with self._lock:
+            pending = key in self._coalesced
+            self._coalesced[key] = (callback, args)
+        if not pending:
+            self._calls.append((key, None, None))
+            if not self._scheduled:
+                self._wakeup()
+
+    def _wakeup(self):
+        self._scheduled = True
+        self._source.set_ready_time(0)
+
+    def _dispatch(self):
+        # Calls posted after _scheduled is cleared wake the source again,
+        # earlier ones are part of this batch.
+        self._source.set_ready_time(-1)
+        self._scheduled = False
+
+        # close() empties the queue, possibly from a callback of this batch
+        # or from another thread.
+        n_calls = len(self._calls)
+        while n_calls > 0:
+            n_calls -= 1
+            try:
+                key, callback, args = self._calls.popleft()
+            except IndexError:
+                break
+            if callback is None:
+                with self._lock:
+                    callback, args = self._coalesced.pop(key, (None, None))
+                if callback is None:
+                    break
+            try:
+                callback(*args)
+            except Exception:
+                sys.excepthook(*sys.exc_info())
+
+    def close(self):
+        self._closed = True
+        self._source.destroy()
+        self._calls.clear()
+        with self._lock:
+            self._coalesced.clear()
+
+    def __del__(self):
+        if hasattr(self, '_source'):
+            self._source.destroy()
+
+__all__.append('CallQueue')
+
+
 # The GI GLib API uses g_io_add_watch_full renamed to g_io_add_watch with
 # a signature of (channel, priority, condition, func, user_data).
 # Prior to PyGObject 3.8, this function was statically bound with an API closer to the
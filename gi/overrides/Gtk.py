@@ -27,6 +27,8 @@ from gi.repository import GObject
 from ..overrides import override, strip_boolean_result, deprecated_init
 from ..module import get_introspection_module
 from gi import PyGIDeprecationWarning
+from .._gi import store_insert_row, store_extend, store_set_values, \
+    tree_model_get_values, tree_model_get_rows
 
 if sys.version_info >= (3, 0):
     _basestring = str
@@ -858,6 +860,17 @@ class TreeModel(Gtk.TreeModel):
             columns.append(cur_col)
         return (result, columns)
 
+    def _get_column_types(self):
+        # column types cannot change once they are set, so cache them for
+        # the native row conversion in ListStore and TreeStore
+        column_types = getattr(self, '_column_types', None)
+        if column_types is None:
+            column_types = tuple(self.get_column_type(i)
+                                 for i in range(self.get_n_columns()))
+            if column_types:
+                self._column_types = column_types
+        return column_types
+
     def set_row(self, treeiter, row):
         converted_row, columns = self._convert_row(row)
         for column in columns:
@@ -875,19 +888,31 @@ class TreeModel(Gtk.TreeModel):
         return GObject.Value(self.get_column_type(column), value)
 
     def get(self, treeiter, *columns):
-        n_columns = self.get_n_columns()
-
-        values = []
-        for col in columns:
-            if not isinstance(col, int):
-                raise TypeError("column numbers must be ints")
+        return tree_model_get_values(self, treeiter, columns)
 
-            if col < 0 or col >= n_columns:
-                raise ValueError("column number is out of range")
+    def get_rows(self, columns=None, start=0, stop=None, parent=None):
+        """Return a list of tuples with the values of the given columns.
 
-            values.append(self.get_value(treeiter, col))
-
-        return tuple(values)
+        The rows are the children of parent (the top level rows if None)
+        in the slice [start:stop], columns defaults to all columns.
+        The model is walked natively, which is considerably faster than
+        reading the rows one value at a time.
+        """
+        start, stop, step = slice(start, stop).indices(self.iter_n_children(parent))
+        return tree_model_get_rows(self, parent, columns, start, stop)
+
+    def iter_rows(self, columns=None, parent=None, batch_size=1000):
+        """Iterate over tuples of column values like get_rows(), reading
+        batch_size rows at a time."""
+        start = 0
+        while True:
+            rows = tree_model_get_rows(self, parent, columns,
+                                       start, start + batch_size)
+            for row in rows:
+                yield row
+            if len(rows) < batch_size:
+                break
+            start += batch_size
 
     #
     # Signals supporting python iterables as tree paths
@@ -944,8 +969,9 @@ class ListStore(Gtk.ListStore, TreeModel, TreeSortable):
 
     def _do_insert(self, position, row):
         if row is not None:
-            row, columns = self._convert_row(row)
-            treeiter = self.insert_with_valuesv(position, columns, row)
+            treeiter = Gtk.TreeIter()
+            store_insert_row(self, treeiter, None, position, row,
+                             self._get_column_types())
         else:
             treeiter = Gtk.ListStore.insert(self, position)
 
@@ -965,6 +991,14 @@ class ListStore(Gtk.ListStore, TreeModel, TreeSortable):
     def insert(self, position, row=None):
         return self._do_insert(position, row)
 
+    def extend(self, rows):
+        """Append all rows of the iterable rows to the store.
+
+        Each row is converted and inserted natively, which is considerably
+        faster than calling append() in a loop.
+        """
+        store_extend(self, None, rows, self._get_column_types())
+
     # FIXME: sends two signals; check if this can use an atomic
     # insert_with_valuesv()
 
@@ -988,18 +1022,21 @@ class ListStore(Gtk.ListStore, TreeModel, TreeSortable):
         return treeiter
 
     def set_value(self, treeiter, column, value):
-        value = self._convert_value(column, value)
-        Gtk.ListStore.set_value(self, treeiter, column, value)
+        store_set_values(self, treeiter, (column,), (value,),
+                         self._get_column_types())
 
     def set(self, treeiter, *args):
 
         def _set_lists(columns, values):
+            columns = list(columns)
+            values = list(values)
             if len(columns) != len(values):
                 raise TypeError('The number of columns do not match the number of values')
-            for col_num, val in zip(columns, values):
+            for col_num in columns:
                 if not isinstance(col_num, int):
                     raise TypeError('TypeError: Expected integer argument for column.')
-                self.set_value(treeiter, col_num, val)
+            store_set_values(self, treeiter, columns, values,
+                             self._get_column_types())
 
         if args:
             if isinstance(args[0], int):
@@ -1075,10 +1112,8 @@ class TreeModelRow(object):
             return self.model.get_value(self.iter, key)
         elif isinstance(key, slice):
             start, stop, step = key.indices(self.model.get_n_columns())
-            alist = []
-            for i in range(start, stop, step):
-                alist.append(self.model.get_value(self.iter, i))
-            return alist
+            return list(tree_model_get_values(self.model, self.iter,
+                                              range(start, stop, step)))
         else:
             raise TypeError("indices must be integers, not %s" % type(key).__name__)
 
@@ -1196,8 +1231,9 @@ class TreeStore(Gtk.TreeStore, TreeModel, TreeSortable):
 
     def _do_insert(self, parent, position, row):
         if row is not None:
-            row, columns = self._convert_row(row)
-            treeiter = self.insert_with_values(parent, position, columns, row)
+            treeiter = Gtk.TreeIter()
+            store_insert_row(self, treeiter, parent, position, row,
+                             self._get_column_types())
         else:
             treeiter = Gtk.TreeStore.insert(self, parent, position)
 
@@ -1212,6 +1248,14 @@ class TreeStore(Gtk.TreeStore, TreeModel, TreeSortable):
     def insert(self, parent, position, row=None):
         return self._do_insert(parent, position, row)
 
+    def extend(self, parent, rows):
+        """Append all rows of the iterable rows as children of parent.
+
+        Each row is converted and inserted natively, which is considerably
+        faster than calling append() in a loop.
+        """
+        store_extend(self, parent, rows, self._get_column_types())
+
     # FIXME: sends two signals; check if this can use an atomic
     # insert_with_valuesv()
 
@@ -1235,18 +1279,21 @@ class TreeStore(Gtk.TreeStore, TreeModel, TreeSortable):
         return treeiter
 
     def set_value(self, treeiter, column, value):
-        value = self._convert_value(column, value)
-        Gtk.TreeStore.set_value(self, treeiter, column, value)
+        store_set_values(self, treeiter, (column,), (value,),
+                         self._get_column_types())
 
     def set(self, treeiter, *args):
 
         def _set_lists(columns, values):
+            columns = list(columns)
+            values = list(values)
             if len(columns) != len(values):
                 raise TypeError('The number of columns do not match the number of values')
-            for col_num, val in zip(columns, values):
+            for col_num in columns:
                 if not isinstance(col_num, int):
                     raise TypeError('TypeError: Expected integer argument for column.')
-                self.set_value(treeiter, col_num, val)
+            store_set_values(self, treeiter, columns, values,
+                             self._get_column_types())
 
         if args:
             if isinstance(args[0], int):
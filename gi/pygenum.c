@@ -31,6 +31,7 @@
 #include "pygenum.h"
 
 GQuark pygenum_class_key;
+GQuark pygenum_value_table_key;
 
 PYGLIB_DEFINE_TYPE("gobject.GEnum", PyGEnum_Type, PyGEnum);
 
@@ -163,6 +164,134 @@ pyg_enum_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
     return ret;
 }
 
+/* Value tables
+ *
+ * Wrapping an enum or flags value coming from C means finding the
+ * instance registered in the class' __enum_values__ (__flags_values__)
+ * dict.  Going through the dict needs a temporary Python int for every
+ * conversion, so the first conversion of a type copies the dict into a
+ * small open addressed table keyed on the raw value and attaches it to
+ * the GType.  The table is rebuilt if another class takes over the
+ * GType (e.g. an override).
+ */
+typedef struct {
+    guint value;
+    PyObject *instance;
+} PyGEnumValueEntry;
+
+typedef struct {
+    PyObject *pyclass;
+    guint mask;
+    PyGEnumValueEntry entries[1];
+} PyGEnumValueTable;
+
+static inline guint
+pyg_enum_value_hash (guint value)
+{
+    value ^= value >> 16;
+    value *= 0x45d9f3b;
+    value ^= value >> 16;
+    return value;
+}
+
+static void
+pyg_enum_value_table_free (PyGEnumValueTable *table)
+{
+    guint i;
+
+    for (i = 0; i <= table->mask; i++)
+	Py_XDECREF(table->entries[i].instance);
+    Py_DECREF(table->pyclass);
+    g_free(table);
+}
+
+static PyGEnumValueTable *
+pyg_enum_value_table_new (PyObject *pyclass, PyObject *values)
+{
+    PyGEnumValueTable *table;
+    PyObject *key, *item;
+    Py_ssize_t pos = 0;
+    guint size = 8;
+
+    while (size < (guint)PyDict_Size(values) * 2)
+	size <<= 1;
+
+    table = g_malloc0(sizeof(PyGEnumValueTable) +
+		      (size - 1) * sizeof(PyGEnumValueEntry));
+    table->mask = size - 1;
+    Py_INCREF(pyclass);
+    table->pyclass = pyclass;
+
+    while (PyDict_Next(values, &pos, &key, &item)) {
+	guint value, i;
+
+	value = (guint)PyLong_AsUnsignedLongMask(key);
+	if (PyErr_Occurred()) {
+	    PyErr_Clear();
+	    continue;
+	}
+
+	i = pyg_enum_value_hash(value) & table->mask;
+	while (table->entries[i].instance != NULL &&
+	       table->entries[i].value != value)
+	    i = (i + 1) & table->mask;
+
+	if (table->entries[i].instance != NULL)
+	    continue;
+	Py_INCREF(item);
+	table->entries[i].value = value;
+	table->entries[i].instance = item;
+    }
+
+    return table;
+}
+
+/*
+ * pyg_enum_value_table_lookup:
+ * @gtype: a GEnum or GFlags type
+ * @pyclass: the wrapper class of @gtype
+ * @values_attr: "__enum_values__" or "__flags_values__"
+ * @value: the raw value
+ *
+ * Returns: a new reference to the registered instance for @value, or
+ * %NULL (without an exception set) if there is none.
+ */
+PyObject *
+pyg_enum_value_table_lookup (GType        gtype,
+			     PyObject    *pyclass,
+			     const char  *values_attr,
+			     guint        value)
+{
+    PyGEnumValueTable *table;
+    guint i;
+
+    table = g_type_get_qdata(gtype, pygenum_value_table_key);
+    if (table == NULL || table->pyclass != pyclass) {
+	PyObject *values;
+
+	values = PyDict_GetItemString(((PyTypeObject *)pyclass)->tp_dict,
+				      values_attr);
+	if (values == NULL || !PyDict_Check(values))
+	    return NULL;
+
+	if (table != NULL)
+	    pyg_enum_value_table_free(table);
+	table = pyg_enum_value_table_new(pyclass, values);
+	g_type_set_qdata(gtype, pygenum_value_table_key, table);
+    }
+
+    i = pyg_enum_value_hash(value) & table->mask;
+    while (table->entries[i].instance != NULL) {
+	if (table->entries[i].value == value) {
+	    Py_INCREF(table->entries[i].instance);
+	    return table->entries[i].instance;
+	}
+	i = (i + 1) & table->mask;
+    }
+
+    return NULL;
+}
+
 PyObject*
 pyg_enum_from_gtype (GType gtype, int value)
 {
@@ -183,6 +312,11 @@ pyg_enum_from_gtype (GType gtype, int value)
     if (!pyclass)
 	return PYGLIB_PyLong_FromLong(value);
 
+    retval = pyg_enum_value_table_lookup(gtype, pyclass, "__enum_values__",
+					 (guint)value);
+    if (retval)
+	return retval;
+
     values = PyDict_GetItemString(((PyTypeObject *)pyclass)->tp_dict,
 				  "__enum_values__");
     intvalue = PYGLIB_PyLong_FromLong(value);
@@ -352,6 +486,7 @@ void
 pygobject_enum_register_types(PyObject *d)
 {
     pygenum_class_key        = g_quark_from_static_string("PyGEnum::class");
+    pygenum_value_table_key  = g_quark_from_static_string("PyGEnum::value-table");
 
     PyGEnum_Type.tp_base = &PYGLIB_PyLong_Type;
 #if PY_VERSION_HEX < 0x03000000
@@ -207,6 +207,11 @@ pyg_flags_from_gtype (GType gtype, guint value)
     if (!pyclass)
 	return PYGLIB_PyLong_FromUnsignedLong(value);
 
+    retval = pyg_enum_value_table_lookup(gtype, pyclass, "__flags_values__",
+					 value);
+    if (retval)
+	return retval;
+
     values = PyDict_GetItemString(((PyTypeObject *)pyclass)->tp_dict,
 				  "__flags_values__");
     pyint = PYGLIB_PyLong_FromUnsignedLong(value);
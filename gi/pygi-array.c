@@ -174,6 +174,73 @@ gi_argument_to_gsize (GIArgument *arg_in,
     }
 }
 
+/* _pygi_marshal_from_py_array_finish:
+ *
+ * Shared tail of the from Python array marshalers: fills in the length
+ * argument if there is one and hands the marshaled array_ to the callee
+ * as either the array itself or, for C arrays, its data.
+ *
+ * Returns: FALSE if the length argument could not be set, in which case
+ *          array_ is left untouched for the caller to free.
+ */
+static gboolean
+_pygi_marshal_from_py_array_finish (PyGIInvokeState   *state,
+                                    PyGICallableCache *callable_cache,
+                                    PyGIArgCache      *arg_cache,
+                                    GArray            *array_,
+                                    Py_ssize_t         length,
+                                    GIArgument        *arg,
+                                    gpointer          *cleanup_data)
+{
+    PyGIArgGArray *array_cache = (PyGIArgGArray *)arg_cache;
+    gboolean is_ptr_array = (array_cache->array_type == GI_ARRAY_TYPE_PTR_ARRAY);
+
+    if (array_cache->len_arg_index >= 0) {
+        /* we have an child arg to handle */
+        PyGIArgCache *child_cache =
+            _pygi_callable_cache_get_arg (callable_cache, array_cache->len_arg_index);
+
+        if (!gi_argument_from_py_ssize_t (&state->arg_values[child_cache->c_arg_index],
+                                          length,
+                                          child_cache->type_tag)) {
+            return FALSE;
+        }
+    }
+
+    if (array_cache->array_type == GI_ARRAY_TYPE_C) {
+        /* In the case of GI_ARRAY_C, we give the data directly as the argument
+         * but keep the array_ wrapper as cleanup data so we don't have to find
+         * it's length again.
+         */
+        arg->v_pointer = array_->data;
+
+        if (arg_cache->transfer == GI_TRANSFER_EVERYTHING) {
+            g_array_free (array_, FALSE);
+            *cleanup_data = NULL;
+        } else {
+            *cleanup_data = array_;
+        }
+    } else {
+        arg->v_pointer = array_;
+
+        if (arg_cache->transfer == GI_TRANSFER_NOTHING) {
+            /* Free everything in cleanup. */
+            *cleanup_data = array_;
+        } else if (arg_cache->transfer == GI_TRANSFER_CONTAINER) {
+            /* Make a shallow copy so we can free the elements later in cleanup
+             * because it is possible invoke will free the list before our cleanup. */
+            *cleanup_data = is_ptr_array ?
+                    (gpointer)g_ptr_array_ref ((GPtrArray *)array_) :
+                    (gpointer)g_array_ref (array_);
+        } else { /* GI_TRANSFER_EVERYTHING */
+            /* No cleanup, everything is given to the callee. */
+            *cleanup_data = NULL;
+        }
+    }
+
+    return TRUE;
+}
+
 static gboolean
 _pygi_marshal_from_py_array (PyGIInvokeState   *state,
                              PyGICallableCache *callable_cache,
@@ -366,50 +433,531 @@ err:
     }
 
 array_success:
-    if (array_cache->len_arg_index >= 0) {
-        /* we have an child arg to handle */
-        PyGIArgCache *child_cache =
-            _pygi_callable_cache_get_arg (callable_cache, array_cache->len_arg_index);
+    if (!_pygi_marshal_from_py_array_finish (state, callable_cache, arg_cache,
+                                             array_, length, arg, cleanup_data))
+        goto err;
 
-        if (!gi_argument_from_py_ssize_t (&state->arg_values[child_cache->c_arg_index],
-                                          length,
-                                          child_cache->type_tag)) {
+    return TRUE;
+}
+
+/*
+ * Bulk marshaling of lists and tuples to C arrays and GArrays of numbers
+ */
+
+/* Number of items converted before range checking and storing them in one
+ * go. Large enough for the store loops to vectorize, small enough for the
+ * scratch buffer to live on the stack.
+ */
+#define PYGI_ARRAY_BULK_BLOCK_SIZE 256
+
+static gboolean
+_pygi_array_bulk_is_supported (PyGIArgGArray *array_cache)
+{
+    PyGIArgCache *item_cache = ((PyGISequenceCache *)array_cache)->item_cache;
+
+    if (array_cache->array_type != GI_ARRAY_TYPE_C &&
+            array_cache->array_type != GI_ARRAY_TYPE_ARRAY)
+        return FALSE;
+
+    switch (item_cache->type_tag) {
+        case GI_TYPE_TAG_INT8:
+        case GI_TYPE_TAG_UINT8:
+        case GI_TYPE_TAG_INT16:
+        case GI_TYPE_TAG_UINT16:
+        case GI_TYPE_TAG_INT32:
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_INT64:
+        case GI_TYPE_TAG_UINT64:
+        case GI_TYPE_TAG_FLOAT:
+        case GI_TYPE_TAG_DOUBLE:
+            return !item_cache->is_pointer;
+        default:
+            return FALSE;
+    }
+}
+
+/* _pygi_array_bulk_get_item:
+ * @py_seq: list or tuple
+ * @index: index of the item to convert
+ * @type_tag: array item type
+ * @value: (out): the item widened to v_int64 (signed integers), v_uint64
+ *   (unsigned integers) or v_double (floating point)
+ *
+ * Exact ints and floats are read directly. Anything else goes through the
+ * generic basic type marshaler, which also produces the usual errors.
+ * No range checking is done for the narrow types, that happens per block.
+ */
+static gboolean
+_pygi_array_bulk_get_item (PyObject   *py_seq,
+                           Py_ssize_t  index,
+                           GITypeTag   type_tag,
+                           GIArgument *value)
+{
+    PyObject *py_item;
+    GIArgument item = {0};
+    gpointer cleanup_data = NULL;
+    gboolean success;
+
+    /* The generic marshaler may run arbitrary Python code which could have
+     * modified a list we are iterating over. */
+    if (index >= PySequence_Fast_GET_SIZE (py_seq)) {
+        PyErr_SetString (PyExc_RuntimeError,
+                         "sequence changed size during marshaling");
+        return FALSE;
+    }
+
+    py_item = PySequence_Fast_GET_ITEM (py_seq, index);
+
+    switch (type_tag) {
+        case GI_TYPE_TAG_FLOAT:
+        case GI_TYPE_TAG_DOUBLE:
+            if (PyFloat_CheckExact (py_item)) {
+                value->v_double = PyFloat_AS_DOUBLE (py_item);
+                return TRUE;
+            }
+            break;
+        case GI_TYPE_TAG_UINT64:
+            if (PyLong_CheckExact (py_item)) {
+                value->v_uint64 = PyLong_AsUnsignedLongLong (py_item);
+                if (!PyErr_Occurred ())
+                    return TRUE;
+                PyErr_Clear ();
+            }
+            break;
+        default:
+#if PY_VERSION_HEX < 0x03000000
+            if (PyInt_CheckExact (py_item)) {
+                value->v_int64 = PyInt_AS_LONG (py_item);
+                return TRUE;
+            }
+#endif
+            if (PyLong_CheckExact (py_item)) {
+                value->v_int64 = PyLong_AsLongLong (py_item);
+                if (!PyErr_Occurred ())
+                    return TRUE;
+                PyErr_Clear ();
+            }
+            break;
+    }
+
+    Py_INCREF (py_item);
+    success = _pygi_marshal_from_py_basic_type (py_item, &item, type_tag,
+                                                GI_TRANSFER_NOTHING,
+                                                &cleanup_data);
+    Py_DECREF (py_item);
+    if (!success)
+        return FALSE;
+
+    switch (type_tag) {
+        case GI_TYPE_TAG_INT8:   value->v_int64 = item.v_int8; break;
+        case GI_TYPE_TAG_UINT8:  value->v_int64 = item.v_uint8; break;
+        case GI_TYPE_TAG_INT16:  value->v_int64 = item.v_int16; break;
+        case GI_TYPE_TAG_UINT16: value->v_int64 = item.v_uint16; break;
+        case GI_TYPE_TAG_INT32:  value->v_int64 = item.v_int32; break;
+        case GI_TYPE_TAG_UINT32: value->v_int64 = item.v_uint32; break;
+        case GI_TYPE_TAG_INT64:  value->v_int64 = item.v_int64; break;
+        case GI_TYPE_TAG_UINT64: value->v_uint64 = item.v_uint64; break;
+        case GI_TYPE_TAG_FLOAT:  value->v_double = item.v_float; break;
+        case GI_TYPE_TAG_DOUBLE: value->v_double = item.v_double; break;
+        default:
+            g_assert_not_reached ();
+    }
+
+    return TRUE;
+}
+
+/* Stores n_items values from scratch into dest, narrowing them to ctype.
+ * The range is accumulated rather than checked per item so the loop has no
+ * branches and can be vectorized. Evaluates to the index of the first item
+ * out of range, or -1.
+ */
+#define _PYGI_ARRAY_BULK_STORE_CHECKED(ctype, member, min, max) \
+    { \
+        ctype *dest_ = (ctype *)dest; \
+        gboolean out_of_range_ = FALSE; \
+        for (i = 0; i < n_items; i++) { \
+            out_of_range_ |= (scratch[i].member < (min)) | (scratch[i].member > (max)); \
+            dest_[i] = (ctype)scratch[i].member; \
+        } \
+        if (out_of_range_) { \
+            for (i = 0; i < n_items; i++) \
+                if (scratch[i].member < (min) || scratch[i].member > (max)) \
+                    return i; \
+        } \
+        return -1; \
+    }
+
+#define _PYGI_ARRAY_BULK_STORE(ctype, member) \
+    { \
+        ctype *dest_ = (ctype *)dest; \
+        for (i = 0; i < n_items; i++) \
+            dest_[i] = scratch[i].member; \
+        return -1; \
+    }
+
+static Py_ssize_t
+_pygi_array_bulk_store (GIArgument *scratch,
+                        Py_ssize_t  n_items,
+                        GITypeTag   type_tag,
+                        gpointer    dest)
+{
+    Py_ssize_t i;
+
+    switch (type_tag) {
+        case GI_TYPE_TAG_INT8:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (gint8, v_int64, G_MININT8, G_MAXINT8)
+        case GI_TYPE_TAG_UINT8:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (guint8, v_int64, 0, G_MAXUINT8)
+        case GI_TYPE_TAG_INT16:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (gint16, v_int64, G_MININT16, G_MAXINT16)
+        case GI_TYPE_TAG_UINT16:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (guint16, v_int64, 0, G_MAXUINT16)
+        case GI_TYPE_TAG_INT32:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (gint32, v_int64, G_MININT32, G_MAXINT32)
+        case GI_TYPE_TAG_UINT32:
+            _PYGI_ARRAY_BULK_STORE_CHECKED (guint32, v_int64, 0, G_MAXUINT32)
+        case GI_TYPE_TAG_FLOAT:
+            /* NaN compares false and infinities are allowed, matching
+             * the checks done for single float arguments. */
+            {
+                gfloat *dest_ = (gfloat *)dest;
+                gboolean out_of_range_ = FALSE;
+                for (i = 0; i < n_items; i++) {
+                    gdouble d = scratch[i].v_double;
+                    out_of_range_ |= (d < -G_MAXFLOAT && d != -INFINITY) |
+                                     (d > G_MAXFLOAT && d != INFINITY);
+                    dest_[i] = (gfloat)d;
+                }
+                if (out_of_range_) {
+                    for (i = 0; i < n_items; i++) {
+                        gdouble d = scratch[i].v_double;
+                        if ((d < -G_MAXFLOAT && d != -INFINITY) ||
+                                (d > G_MAXFLOAT && d != INFINITY))
+                            return i;
+                    }
+                }
+                return -1;
+            }
+        case GI_TYPE_TAG_INT64:
+            _PYGI_ARRAY_BULK_STORE (gint64, v_int64)
+        case GI_TYPE_TAG_UINT64:
+            _PYGI_ARRAY_BULK_STORE (guint64, v_uint64)
+        case GI_TYPE_TAG_DOUBLE:
+            _PYGI_ARRAY_BULK_STORE (gdouble, v_double)
+        default:
+            g_assert_not_reached ();
+            return -1;
+    }
+}
+
+#undef _PYGI_ARRAY_BULK_STORE_CHECKED
+#undef _PYGI_ARRAY_BULK_STORE
+
+/* _pygi_array_buffer_matches:
+ *
+ * Checks that the one dimensional buffer @view holds items of exactly the C
+ * type described by @type_tag and @item_size, so its memory can be used as
+ * the array data as is.
+ */
+static gboolean
+_pygi_array_buffer_matches (Py_buffer *view,
+                            GITypeTag  type_tag,
+                            gsize      item_size)
+{
+    const gchar *format = view->format;
+    const gchar *kinds;
+
+    if (view->ndim > 1 || view->itemsize != item_size)
+        return FALSE;
+
+    /* A NULL format means unsigned bytes. */
+    if (format == NULL)
+        format = "B";
+
+    switch (format[0]) {
+        case '@':
+        case '=':
+            format++;
+            break;
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+        case '<':
+#else
+        case '>':
+        case '!':
+#endif
+            format++;
+            break;
+        default:
+            break;
+    }
+
+    if (format[0] == '\0' || format[1] != '\0')
+        return FALSE;
+
+    switch (type_tag) {
+        case GI_TYPE_TAG_INT8:
+        case GI_TYPE_TAG_INT16:
+        case GI_TYPE_TAG_INT32:
+        case GI_TYPE_TAG_INT64:
+            kinds = "bhilqn";
+            break;
+        case GI_TYPE_TAG_UINT8:
+        case GI_TYPE_TAG_UINT16:
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_UINT64:
+            kinds = "BHILQN";
+            break;
+        case GI_TYPE_TAG_FLOAT:
+            kinds = "f";
+            break;
+        case GI_TYPE_TAG_DOUBLE:
+            kinds = "d";
+            break;
+        default:
+            return FALSE;
+    }
+
+    return strchr (kinds, format[0]) != NULL;
+}
+
+/* _pygi_array_get_buffer:
+ * @view: (out): filled in when TRUE is returned, release with PyBuffer_Release
+ *
+ * Returns: TRUE if @py_arg exposes a contiguous buffer with items matching
+ *          the array item type. No exception is set otherwise.
+ */
+static gboolean
+_pygi_array_get_buffer (PyGIArgGArray *array_cache,
+                        PyObject      *py_arg,
+                        Py_buffer     *view)
+{
+    PyGIArgCache *item_cache = ((PyGISequenceCache *)array_cache)->item_cache;
+
+    if (!PyObject_CheckBuffer (py_arg))
+        return FALSE;
+
+    if (PyObject_GetBuffer (py_arg, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        PyErr_Clear ();
+        return FALSE;
+    }
+
+    if (!_pygi_array_buffer_matches (view, item_cache->type_tag,
+                                     array_cache->item_size)) {
+        PyBuffer_Release (view);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* _pygi_marshal_from_py_array_basic:
+ *
+ * Specialization of _pygi_marshal_from_py_array for C arrays and GArrays of
+ * numbers, selected in pygi_arg_garray_setup. Lists and tuples are read from
+ * their storage directly and written straight into the array, anything else
+ * goes through the generic marshaler.
+ */
+static gboolean
+_pygi_marshal_from_py_array_basic (PyGIInvokeState   *state,
+                                   PyGICallableCache *callable_cache,
+                                   PyGIArgCache      *arg_cache,
+                                   PyObject          *py_arg,
+                                   GIArgument        *arg,
+                                   gpointer          *cleanup_data)
+{
+    PyGIArgGArray *array_cache = (PyGIArgGArray *)arg_cache;
+    GITypeTag item_type_tag = ((PyGISequenceCache *)arg_cache)->item_cache->type_tag;
+    GIArgument scratch[PYGI_ARRAY_BULK_BLOCK_SIZE];
+    Py_ssize_t length, start, i = 0;
+    GArray *array_;
+
+    if (!PyList_Check (py_arg) && !PyTuple_Check (py_arg)) {
+        Py_buffer view;
+
+        if (py_arg == Py_None ||
+                !_pygi_array_get_buffer (array_cache, py_arg, &view)) {
+            return _pygi_marshal_from_py_array (state, callable_cache, arg_cache,
+                                                py_arg, arg, cleanup_data);
+        }
+
+        /* Buffers with matching items are copied in one go. */
+        length = view.len / view.itemsize;
+        if (array_cache->fixed_size >= 0 &&
+                array_cache->fixed_size != length) {
+            PyErr_Format (PyExc_ValueError, "Must contain %zd items, not %zd",
+                          array_cache->fixed_size, length);
+            PyBuffer_Release (&view);
+            return FALSE;
+        }
+
+        array_ = g_array_sized_new (array_cache->is_zero_terminated,
+                                    FALSE,
+                                    array_cache->item_size,
+                                    length);
+        g_array_append_vals (array_, view.buf, length);
+        PyBuffer_Release (&view);
+
+        if (!_pygi_marshal_from_py_array_finish (state, callable_cache, arg_cache,
+                                                 array_, length, arg, cleanup_data)) {
+            g_array_free (array_, TRUE);
+            return FALSE;
+        }
+
+        return TRUE;
+    }
+
+    length = PySequence_Fast_GET_SIZE (py_arg);
+
+    if (array_cache->fixed_size >= 0 &&
+            array_cache->fixed_size != length) {
+        PyErr_Format (PyExc_ValueError, "Must contain %zd items, not %zd",
+                      array_cache->fixed_size, length);
+
+        return FALSE;
+    }
+
+    /* Every item gets written below, so there is no need to clear. */
+    array_ = g_array_sized_new (array_cache->is_zero_terminated,
+                                FALSE,
+                                array_cache->item_size,
+                                length);
+    if (array_ == NULL) {
+        PyErr_NoMemory ();
+        return FALSE;
+    }
+    g_array_set_size (array_, length);
+
+    for (start = 0; start < length; start += PYGI_ARRAY_BULK_BLOCK_SIZE) {
+        Py_ssize_t n_items = MIN (PYGI_ARRAY_BULK_BLOCK_SIZE, length - start);
+
+        for (i = 0; i < n_items; i++) {
+            if (!_pygi_array_bulk_get_item (py_arg, start + i,
+                                            item_type_tag, &scratch[i]))
+                goto err;
+        }
+
+        i = _pygi_array_bulk_store (scratch, n_items, item_type_tag,
+                                    array_->data + start * array_cache->item_size);
+        if (i >= 0) {
+            /* Let the generic marshaler raise the usual overflow error. */
+            GIArgument item;
+            gpointer item_cleanup_data = NULL;
+
+            if (_pygi_marshal_from_py_basic_type (PySequence_Fast_GET_ITEM (py_arg, start + i),
+                                                  &item, item_type_tag,
+                                                  GI_TRANSFER_NOTHING,
+                                                  &item_cleanup_data)) {
+                PyErr_SetString (PyExc_OverflowError, "value out of range");
+            }
             goto err;
         }
     }
 
-    if (array_cache->array_type == GI_ARRAY_TYPE_C) {
-        /* In the case of GI_ARRAY_C, we give the data directly as the argument
-         * but keep the array_ wrapper as cleanup data so we don't have to find
-         * it's length again.
-         */
-        arg->v_pointer = array_->data;
+    if (!_pygi_marshal_from_py_array_finish (state, callable_cache, arg_cache,
+                                             array_, length, arg, cleanup_data)) {
+        g_array_free (array_, TRUE);
+        return FALSE;
+    }
 
-        if (arg_cache->transfer == GI_TRANSFER_EVERYTHING) {
-            g_array_free (array_, FALSE);
-            *cleanup_data = NULL;
-        } else {
-            *cleanup_data = array_;
+    return TRUE;
+
+err:
+    g_array_free (array_, TRUE);
+    _PyGI_ERROR_PREFIX ("Item %i: ", (int)(start + i));
+    return FALSE;
+}
+
+/* Cleanup data of _pygi_marshal_from_py_c_array_borrow */
+typedef struct {
+    /* Set when the C array points directly into a buffer. */
+    Py_buffer view;
+    /* Cleanup data of the copying marshalers otherwise. */
+    gpointer array_cleanup_data;
+} PyGIArrayBorrowData;
+
+/* _pygi_array_can_borrow:
+ *
+ * Input only C arrays of numbers which the callee does not take ownership
+ * of can use the memory of a Python buffer for the duration of the call.
+ * Zero terminated arrays are excluded as the buffer has no terminator.
+ */
+static gboolean
+_pygi_array_can_borrow (PyGIArgGArray *array_cache)
+{
+    PyGIArgCache *arg_cache = (PyGIArgCache *)array_cache;
+
+    return _pygi_array_bulk_is_supported (array_cache) &&
+           array_cache->array_type == GI_ARRAY_TYPE_C &&
+           !array_cache->is_zero_terminated &&
+           arg_cache->transfer == GI_TRANSFER_NOTHING &&
+           arg_cache->direction == PYGI_DIRECTION_FROM_PYTHON;
+}
+
+/* _pygi_marshal_from_py_c_array_borrow:
+ *
+ * Marshaler for arrays accepted by _pygi_array_can_borrow. Objects exposing
+ * a buffer with matching items (array.array, numpy arrays, memoryviews, ...)
+ * are passed to the callee without copying, the buffer is held until
+ * cleanup. Everything else is copied by _pygi_marshal_from_py_array_basic.
+ */
+static gboolean
+_pygi_marshal_from_py_c_array_borrow (PyGIInvokeState   *state,
+                                      PyGICallableCache *callable_cache,
+                                      PyGIArgCache      *arg_cache,
+                                      PyObject          *py_arg,
+                                      GIArgument        *arg,
+                                      gpointer          *cleanup_data)
+{
+    PyGIArgGArray *array_cache = (PyGIArgGArray *)arg_cache;
+    PyGIArrayBorrowData *borrow;
+
+    borrow = g_slice_new0 (PyGIArrayBorrowData);
+
+    if (py_arg != Py_None && !PyList_Check (py_arg) && !PyTuple_Check (py_arg) &&
+            _pygi_array_get_buffer (array_cache, py_arg, &borrow->view)) {
+        Py_ssize_t length = borrow->view.len / borrow->view.itemsize;
+
+        if (array_cache->fixed_size >= 0 &&
+                array_cache->fixed_size != length) {
+            PyErr_Format (PyExc_ValueError, "Must contain %zd items, not %zd",
+                          array_cache->fixed_size, length);
+            goto err;
         }
-    } else {
-        arg->v_pointer = array_;
 
-        if (arg_cache->transfer == GI_TRANSFER_NOTHING) {
-            /* Free everything in cleanup. */
-            *cleanup_data = array_;
-        } else if (arg_cache->transfer == GI_TRANSFER_CONTAINER) {
-            /* Make a shallow copy so we can free the elements later in cleanup
-             * because it is possible invoke will free the list before our cleanup. */
-            *cleanup_data = is_ptr_array ?
-                    (gpointer)g_ptr_array_ref ((GPtrArray *)array_) :
-                    (gpointer)g_array_ref (array_);
-        } else { /* GI_TRANSFER_EVERYTHING */
-            /* No cleanup, everything is given to the callee. */
-            *cleanup_data = NULL;
+        if (array_cache->len_arg_index >= 0) {
+            PyGIArgCache *child_cache =
+                _pygi_callable_cache_get_arg (callable_cache, array_cache->len_arg_index);
+
+            if (!gi_argument_from_py_ssize_t (&state->arg_values[child_cache->c_arg_index],
+                                              length,
+                                              child_cache->type_tag)) {
+                goto err;
+            }
         }
+
+        arg->v_pointer = borrow->view.buf;
+        *cleanup_data = borrow;
+        return TRUE;
+    }
+
+    if (!_pygi_marshal_from_py_array_basic (state, callable_cache, arg_cache,
+                                            py_arg, arg, &borrow->array_cleanup_data)) {
+        g_slice_free (PyGIArrayBorrowData, borrow);
+        return FALSE;
     }
 
+    if (borrow->array_cleanup_data == NULL) {
+        g_slice_free (PyGIArrayBorrowData, borrow);
+        *cleanup_data = NULL;
+    } else {
+        *cleanup_data = borrow;
+    }
     return TRUE;
+
+err:
+    PyBuffer_Release (&borrow->view);
+    g_slice_free (PyGIArrayBorrowData, borrow);
+    return FALSE;
 }
 
 static void
@@ -482,6 +1030,26 @@ _pygi_marshal_cleanup_from_py_array (PyGIInvokeState *state,
     }
 }
 
+static void
+_pygi_marshal_cleanup_from_py_c_array_borrow (PyGIInvokeState *state,
+                                              PyGIArgCache    *arg_cache,
+                                              PyObject        *py_arg,
+                                              gpointer         data,
+                                              gboolean         was_processed)
+{
+    PyGIArrayBorrowData *borrow = data;
+
+    if (borrow->view.obj != NULL) {
+        PyBuffer_Release (&borrow->view);
+    } else {
+        _pygi_marshal_cleanup_from_py_array (state, arg_cache, py_arg,
+                                             borrow->array_cleanup_data,
+                                             was_processed);
+    }
+
+    g_slice_free (PyGIArrayBorrowData, borrow);
+}
+
 /*
  * GArray from Python
  */
@@ -658,6 +1226,257 @@ err:
     return NULL;
 }
 
+/*
+ * Array buffers
+ */
+
+/* Buffer owning a C array of numbers returned with transfer full (or a
+ * reference to whatever holds the memory), exposing it through the buffer
+ * protocol without copying.
+ */
+typedef struct {
+    PyObject_HEAD
+    gpointer data;
+    GDestroyNotify free_func;
+    gpointer free_data;
+    gboolean readonly;
+    const gchar *format;
+    Py_ssize_t shape[1];
+    Py_ssize_t strides[1];
+} PyGIArrayBuffer;
+
+PYGLIB_DEFINE_TYPE("gi.ArrayBuffer", PyGIArrayBuffer_Type, PyGIArrayBuffer);
+
+static GHashTable *array_buffer_namespaces = NULL;
+
+/* pygi_array_buffers_enable:
+ * @namespace_: introspection namespace, e.g. "GIMarshallingTests"
+ * @enable: whether to enable or disable array buffers
+ *
+ * When enabled, C arrays of numbers returned with transfer full by callables
+ * of @namespace_ are returned as gi.ArrayBuffer objects instead of lists.
+ */
+void
+pygi_array_buffers_enable (const gchar *namespace_,
+                           gboolean     enable)
+{
+    if (array_buffer_namespaces == NULL)
+        array_buffer_namespaces = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                         g_free, NULL);
+
+    if (enable)
+        g_hash_table_add (array_buffer_namespaces, g_strdup (namespace_));
+    else
+        g_hash_table_remove (array_buffer_namespaces, namespace_);
+}
+
+gboolean
+pygi_array_buffers_enabled (const gchar *namespace_)
+{
+    return array_buffer_namespaces != NULL && namespace_ != NULL &&
+           g_hash_table_contains (array_buffer_namespaces, namespace_);
+}
+
+static const gchar *
+_pygi_array_buffer_format (GITypeTag type_tag)
+{
+    switch (type_tag) {
+        case GI_TYPE_TAG_INT8:
+            return "b";
+        case GI_TYPE_TAG_UINT8:
+            return "B";
+        case GI_TYPE_TAG_INT16:
+            return "h";
+        case GI_TYPE_TAG_UINT16:
+            return "H";
+        case GI_TYPE_TAG_INT32:
+            return "i";
+        case GI_TYPE_TAG_UINT32:
+            return "I";
+        case GI_TYPE_TAG_INT64:
+            return "q";
+        case GI_TYPE_TAG_UINT64:
+            return "Q";
+        case GI_TYPE_TAG_FLOAT:
+            return "f";
+        case GI_TYPE_TAG_DOUBLE:
+            return "d";
+        default:
+            return NULL;
+    }
+}
+
+/* pygi_array_buffer_new:
+ * @data: start of the items
+ * @n_items: number of items
+ * @item_size: size of one item in bytes
+ * @format: struct module format of one item
+ * @readonly: whether consumers may write to @data
+ * @free_func: (allow-none): called with @free_data when the buffer dies
+ * @free_data: owner of @data, e.g. @data itself or a GVariant
+ *
+ * Returns: a new gi.ArrayBuffer, taking ownership of @free_data
+ */
+PyObject *
+pygi_array_buffer_new (gpointer        data,
+                       gsize           n_items,
+                       gsize           item_size,
+                       const gchar    *format,
+                       gboolean        readonly,
+                       GDestroyNotify  free_func,
+                       gpointer        free_data)
+{
+    PyGIArrayBuffer *self;
+
+    self = (PyGIArrayBuffer *) PyGIArrayBuffer_Type.tp_alloc (&PyGIArrayBuffer_Type, 0);
+    if (self == NULL)
+        return NULL;
+
+    self->data = data;
+    self->free_func = free_func;
+    self->free_data = free_data;
+    self->readonly = readonly;
+    self->format = format;
+    self->shape[0] = n_items;
+    self->strides[0] = item_size;
+
+    return (PyObject *)self;
+}
+
+static int
+_array_buffer_getbuffer (PyGIArrayBuffer *self, Py_buffer *view, int flags)
+{
+    static gchar empty[1];
+
+    if (self->readonly && (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString (PyExc_BufferError, "gi.ArrayBuffer is read-only");
+        view->obj = NULL;
+        return -1;
+    }
+
+    view->obj = (PyObject *)self;
+    Py_INCREF (self);
+    view->buf = self->data != NULL ? self->data : empty;
+    view->len = self->shape[0] * self->strides[0];
+    view->readonly = self->readonly;
+    view->itemsize = self->strides[0];
+    view->format = (flags & PyBUF_FORMAT) ? (char *)self->format : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+
+    return 0;
+}
+
+static Py_ssize_t
+_array_buffer_length (PyGIArrayBuffer *self)
+{
+    return self->shape[0];
+}
+
+static void
+_array_buffer_dealloc (PyGIArrayBuffer *self)
+{
+    if (self->free_func != NULL)
+        self->free_func (self->free_data);
+
+    Py_TYPE (self)->tp_free ((PyObject *)self);
+}
+
+static PyBufferProcs _array_buffer_as_buffer;
+static PySequenceMethods _array_buffer_as_sequence;
+
+/* _pygi_array_buffer_can_return:
+ *
+ * C arrays of numbers other than guint8 (which are returned as bytes)
+ * whose memory is owned by the caller can be returned as gi.ArrayBuffer.
+ */
+static gboolean
+_pygi_array_buffer_can_return (PyGIArgGArray *array_cache)
+{
+    PyGIArgCache *arg_cache = (PyGIArgCache *)array_cache;
+    PyGIArgCache *item_cache = ((PyGISequenceCache *)array_cache)->item_cache;
+
+    return _pygi_array_bulk_is_supported (array_cache) &&
+           item_cache->type_tag != GI_TYPE_TAG_UINT8 &&
+           array_cache->array_type == GI_ARRAY_TYPE_C &&
+           !array_cache->is_zero_terminated &&
+           arg_cache->transfer == GI_TRANSFER_EVERYTHING &&
+           arg_cache->direction == PYGI_DIRECTION_TO_PYTHON;
+}
+
+/* _pygi_marshal_to_py_c_array_buffer:
+ *
+ * Marshaler for arrays accepted by _pygi_array_buffer_can_return. When array
+ * buffers are enabled for the namespace of the callable the C array is
+ * handed over to a gi.ArrayBuffer, otherwise a list is returned as usual.
+ */
+static PyObject *
+_pygi_marshal_to_py_c_array_buffer (PyGIInvokeState   *state,
+                                    PyGICallableCache *callable_cache,
+                                    PyGIArgCache      *arg_cache,
+                                    GIArgument        *arg)
+{
+    PyGIArgGArray *array_cache = (PyGIArgGArray *)arg_cache;
+    PyGIArgCache *item_cache = ((PyGISequenceCache *)array_cache)->item_cache;
+    PyGIArrayBuffer *self;
+    gsize len = 0;
+
+    if (!pygi_array_buffers_enabled (array_cache->namespace_) ||
+            (array_cache->fixed_size < 0 && array_cache->len_arg_index < 0))
+        return _pygi_marshal_to_py_array (state, callable_cache, arg_cache, arg);
+
+    if (array_cache->fixed_size >= 0) {
+        len = array_cache->fixed_size;
+    } else if (arg->v_pointer != NULL) {
+        GIArgument *len_arg = &state->arg_values[array_cache->len_arg_index];
+        PyGIArgCache *len_cache = _pygi_callable_cache_get_arg (callable_cache,
+                                                                array_cache->len_arg_index);
+
+        if (!gi_argument_to_gsize (len_arg, &len, len_cache->type_tag)) {
+            return NULL;
+        }
+    }
+
+    self = (PyGIArrayBuffer *) pygi_array_buffer_new (arg->v_pointer,
+                                                      (arg->v_pointer != NULL) ? len : 0,
+                                                      array_cache->item_size,
+                                                      _pygi_array_buffer_format (item_cache->type_tag),
+                                                      FALSE,
+                                                      g_free,
+                                                      arg->v_pointer);
+    if (self == NULL)
+        return NULL;
+
+    /* The buffer owns the memory now, make sure cleanup does not free it. */
+    arg->v_pointer = NULL;
+
+    return (PyObject *)self;
+}
+
+void
+_pygi_array_register_types (PyObject *m)
+{
+    Py_TYPE(&PyGIArrayBuffer_Type) = &PyType_Type;
+    PyGIArrayBuffer_Type.tp_flags = Py_TPFLAGS_DEFAULT;
+#if PY_VERSION_HEX < 0x03000000
+    PyGIArrayBuffer_Type.tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+    PyGIArrayBuffer_Type.tp_dealloc = (destructor) _array_buffer_dealloc;
+
+    _array_buffer_as_buffer.bf_getbuffer = (getbufferproc) _array_buffer_getbuffer;
+    PyGIArrayBuffer_Type.tp_as_buffer = &_array_buffer_as_buffer;
+    _array_buffer_as_sequence.sq_length = (lenfunc) _array_buffer_length;
+    PyGIArrayBuffer_Type.tp_as_sequence = &_array_buffer_as_sequence;
+
+    if (PyType_Ready (&PyGIArrayBuffer_Type))
+        return;
+    if (PyModule_AddObject (m, "ArrayBuffer", (PyObject *) &PyGIArrayBuffer_Type))
+        return;
+}
+
 static GArray*
 _wrap_c_array (PyGIInvokeState   *state,
                PyGIArgGArray     *array_cache,
@@ -861,14 +1680,26 @@ pygi_arg_garray_setup (PyGIArgGArray     *sc,
     item_type_info = g_type_info_get_param_type (type_info, 0);
     sc->item_size = _pygi_g_type_info_size (item_type_info);
     g_base_info_unref ( (GIBaseInfo *)item_type_info);
+    sc->namespace_ = g_base_info_get_namespace ((GIBaseInfo *)type_info);
 
     if (direction & PYGI_DIRECTION_FROM_PYTHON) {
-        arg_cache->from_py_marshaller = _pygi_marshal_from_py_array;
-        arg_cache->from_py_cleanup = _pygi_marshal_cleanup_from_py_array;
+        if (_pygi_array_can_borrow (sc)) {
+            arg_cache->from_py_marshaller = _pygi_marshal_from_py_c_array_borrow;
+            arg_cache->from_py_cleanup = _pygi_marshal_cleanup_from_py_c_array_borrow;
+        } else {
+            if (_pygi_array_bulk_is_supported (sc))
+                arg_cache->from_py_marshaller = _pygi_marshal_from_py_array_basic;
+            else
+                arg_cache->from_py_marshaller = _pygi_marshal_from_py_array;
+            arg_cache->from_py_cleanup = _pygi_marshal_cleanup_from_py_array;
+        }
     }
 
     if (direction & PYGI_DIRECTION_TO_PYTHON) {
-        arg_cache->to_py_marshaller = _pygi_marshal_to_py_array;
+        if (_pygi_array_buffer_can_return (sc))
+            arg_cache->to_py_marshaller = _pygi_marshal_to_py_c_array_buffer;
+        else
+            arg_cache->to_py_marshaller = _pygi_marshal_to_py_array;
         arg_cache->to_py_cleanup = _pygi_marshal_cleanup_to_py_array;
     }
 
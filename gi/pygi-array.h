@@ -38,6 +38,21 @@ PyGIArgCache *pygi_arg_garray_len_arg_setup  (PyGIArgCache      *arg_cache,
                                               gssize             arg_index,
                                               gssize            *py_arg_index);
 
+void          pygi_array_buffers_enable      (const gchar       *namespace_,
+                                              gboolean           enable);
+
+gboolean      pygi_array_buffers_enabled     (const gchar       *namespace_);
+
+PyObject     *pygi_array_buffer_new          (gpointer           data,
+                                              gsize              n_items,
+                                              gsize              item_size,
+                                              const gchar       *format,
+                                              gboolean           readonly,
+                                              GDestroyNotify     free_func,
+                                              gpointer           free_data);
+
+void          _pygi_array_register_types     (PyObject          *m);
+
 G_END_DECLS
 
 #endif /*__PYGI_ARRAY_H__*/
@@ -0,0 +1,536 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ *   pygi-async.c: awaitable results of GIO style async functions.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pygi-private.h"
+#include "pygobject-private.h"
+#include "pygi-async.h"
+#include "pygi-invoke.h"
+
+#include <structmember.h>
+#include <pyglib-python-compat.h>
+
+/*
+ * A gi.Async is returned by functions taking a GAsyncReadyCallback with a
+ * matching *_finish() function when they are called without a callback.
+ * pygi_async_finish_cb() is passed to the C function instead of a Python
+ * closure and calls the finish function once the operation completes.
+ *
+ * The object implements the asyncio future protocol, so it can be awaited
+ * in a coroutine or passed to asyncio.ensure_future(). Without asyncio,
+ * done callbacks are called directly from the main loop.
+ */
+
+PYGLIB_DEFINE_TYPE("gi.Async", PyGIAsync_Type, PyGIAsync);
+
+/* Returns a new reference to the running asyncio loop, or NULL without an
+ * exception set if there is none. asyncio is not imported for this. */
+static PyObject *
+_pygi_async_get_running_loop (void)
+{
+    PyObject *asyncio, *loop;
+
+    asyncio = PyDict_GetItemString (PyImport_GetModuleDict (), "asyncio");
+    if (asyncio == NULL)
+        return NULL;
+
+    loop = PyObject_CallMethod (asyncio, "_get_running_loop", NULL);
+    if (loop == NULL) {
+        PyErr_Clear ();
+        return NULL;
+    }
+    if (loop == Py_None) {
+        Py_DECREF (loop);
+        return NULL;
+    }
+    return loop;
+}
+
+/* Sets the asyncio exception @name, or @fallback when asyncio is not
+ * available. */
+static void
+_pygi_async_set_error (const char *name, PyObject *fallback, const char *msg)
+{
+    PyObject *asyncio, *exc_type = NULL;
+
+    asyncio = PyImport_ImportModule ("asyncio");
+    if (asyncio != NULL) {
+        exc_type = PyObject_GetAttrString (asyncio, name);
+        Py_DECREF (asyncio);
+    }
+    if (exc_type == NULL) {
+        PyErr_Clear ();
+        exc_type = fallback;
+        Py_INCREF (exc_type);
+    }
+
+    PyErr_SetString (exc_type, msg);
+    Py_DECREF (exc_type);
+}
+
+static void
+_pygi_async_call_callback (PyGIAsync *self, PyObject *callback, PyObject *context)
+{
+    PyObject *ret;
+
+    if (self->loop != NULL) {
+        PyObject *call_soon, *args, *kwargs = NULL;
+
+        call_soon = PyObject_GetAttrString (self->loop, "call_soon");
+        if (call_soon == NULL) {
+            PyErr_Print ();
+            return;
+        }
+
+        args = PyTuple_Pack (2, callback, (PyObject *) self);
+        if (context != Py_None)
+            kwargs = Py_BuildValue ("{sO}", "context", context);
+
+        ret = PyObject_Call (call_soon, args, kwargs);
+
+        Py_DECREF (call_soon);
+        Py_DECREF (args);
+        Py_XDECREF (kwargs);
+    } else {
+        ret = PyObject_CallFunctionObjArgs (callback, (PyObject *) self, NULL);
+    }
+
+    if (ret == NULL)
+        PyErr_Print ();
+    else
+        Py_DECREF (ret);
+}
+
+static void
+_pygi_async_set_done (PyGIAsync *self)
+{
+    PyObject *callbacks;
+    Py_ssize_t i;
+
+    self->done = TRUE;
+
+    callbacks = self->callbacks;
+    self->callbacks = NULL;
+    if (callbacks == NULL)
+        return;
+
+    for (i = 0; i < PyList_GET_SIZE (callbacks); i++) {
+        PyObject *item = PyList_GET_ITEM (callbacks, i);
+
+        _pygi_async_call_callback (self,
+                                   PyTuple_GET_ITEM (item, 0),
+                                   PyTuple_GET_ITEM (item, 1));
+    }
+
+    Py_DECREF (callbacks);
+}
+
+/**
+ * pygi_async_new:
+ * @finish_func: the PyGIFunctionInfo of the *_finish() function
+ * @finish_is_method: whether @finish_func takes the source object
+ * @finish_class: (allow-none): the class passed to @finish_func if it is a
+ *   constructor
+ * @cancellable: (allow-none): the GCancellable passed to the operation
+ *
+ * Returns: a new gi.Async, or NULL with an exception set.
+ */
+PyObject *
+pygi_async_new (PyObject *finish_func,
+                gboolean  finish_is_method,
+                PyObject *finish_class,
+                PyObject *cancellable)
+{
+    PyGIAsync *self;
+
+    self = (PyGIAsync *) PyGIAsync_Type.tp_alloc (&PyGIAsync_Type, 0);
+    if (self == NULL)
+        return NULL;
+
+    Py_INCREF (finish_func);
+    self->finish_func = finish_func;
+    self->finish_is_method = finish_is_method;
+    Py_XINCREF (finish_class);
+    self->finish_class = finish_class;
+    Py_XINCREF (cancellable);
+    self->cancellable = cancellable;
+    self->loop = _pygi_async_get_running_loop ();
+
+    return (PyObject *) self;
+}
+
+/**
+ * pygi_async_finish_cb:
+ *
+ * GAsyncReadyCallback for operations started with a gi.Async as user data.
+ * Calls the finish function, stores its result or exception and runs the
+ * done callbacks. Releases the reference held for the operation.
+ */
+void
+pygi_async_finish_cb (GObject  *source_object,
+                      gpointer  res,
+                      gpointer  user_data)
+{
+    PyGIAsync *self = user_data;
+    PyGILState_STATE state;
+    PyObject *py_args[3];
+    Py_ssize_t n_args = 0;
+    PyObject *py_source = NULL, *py_res, *ret = NULL;
+
+    state = pyglib_gil_state_ensure ();
+
+    if (self->finish_class != NULL)
+        py_args[n_args++] = self->finish_class;
+
+    if (self->finish_is_method) {
+        if (source_object != NULL) {
+            py_source = pygobject_new (source_object);
+        } else {
+            Py_INCREF (Py_None);
+            py_source = Py_None;
+        }
+        py_args[n_args++] = py_source;
+    }
+
+    py_res = pygobject_new (res);
+    py_args[n_args++] = py_res;
+
+    if (py_res != NULL && (py_source != NULL || !self->finish_is_method))
+        ret = pygi_callable_info_invoke ((PyGIBaseInfo *) self->finish_func,
+                                         py_args, n_args, NULL);
+
+    Py_XDECREF (py_source);
+    Py_XDECREF (py_res);
+
+    if (self->done) {
+        /* cancelled in the meantime, the finish call only cleans up */
+        Py_XDECREF (ret);
+        PyErr_Clear ();
+    } else {
+        if (ret != NULL) {
+            self->result = ret;
+        } else {
+            PyObject *type, *value, *traceback;
+
+            PyErr_Fetch (&type, &value, &traceback);
+            PyErr_NormalizeException (&type, &value, &traceback);
+#if PY_VERSION_HEX >= 0x03000000
+            if (traceback != NULL)
+                PyException_SetTraceback (value, traceback);
+#endif
+            self->exception = value;
+            Py_XDECREF (type);
+            Py_XDECREF (traceback);
+        }
+        _pygi_async_set_done (self);
+    }
+
+    Py_DECREF (self);
+
+    pyglib_gil_state_release (state);
+}
+
+static PyObject *
+_pygi_async_result (PyGIAsync *self)
+{
+    if (self->cancelled) {
+        _pygi_async_set_error ("CancelledError", PyExc_RuntimeError,
+                               "the operation was cancelled");
+        return NULL;
+    }
+    if (!self->done) {
+        _pygi_async_set_error ("InvalidStateError", PyExc_RuntimeError,
+                               "the operation has not finished yet");
+        return NULL;
+    }
+    if (self->exception != NULL) {
+        PyErr_SetObject ((PyObject *) Py_TYPE (self->exception), self->exception);
+        return NULL;
+    }
+
+    Py_INCREF (self->result);
+    return self->result;
+}
+
+static PyObject *
+_pygi_async_exception (PyGIAsync *self)
+{
+    PyObject *exception;
+
+    if (self->cancelled) {
+        _pygi_async_set_error ("CancelledError", PyExc_RuntimeError,
+                               "the operation was cancelled");
+        return NULL;
+    }
+    if (!self->done) {
+        _pygi_async_set_error ("InvalidStateError", PyExc_RuntimeError,
+                               "the operation has not finished yet");
+        return NULL;
+    }
+
+    exception = self->exception != NULL ? self->exception : Py_None;
+    Py_INCREF (exception);
+    return exception;
+}
+
+static PyObject *
+_pygi_async_done (PyGIAsync *self)
+{
+    return PyBool_FromLong (self->done);
+}
+
+static PyObject *
+_pygi_async_cancelled (PyGIAsync *self)
+{
+    return PyBool_FromLong (self->cancelled);
+}
+
+/* cancel(msg=None): cancels the GCancellable passed to the operation, if
+ * any, and marks the result as cancelled right away. */
+static PyObject *
+_pygi_async_cancel (PyGIAsync *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "msg", NULL };
+    PyObject *msg = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords (args, kwargs, "|O:Async.cancel", kwlist, &msg))
+        return NULL;
+
+    if (self->done)
+        Py_RETURN_FALSE;
+
+    if (self->cancellable != NULL) {
+        PyObject *ret = PyObject_CallMethod (self->cancellable, "cancel", NULL);
+        if (ret == NULL)
+            return NULL;
+        Py_DECREF (ret);
+    }
+
+    self->cancelled = TRUE;
+    _pygi_async_set_done (self);
+
+    Py_RETURN_TRUE;
+}
+
+static PyObject *
+_pygi_async_add_done_callback (PyGIAsync *self, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = { "callback", "context", NULL };
+    PyObject *callback, *context = Py_None, *item;
+
+    if (!PyArg_ParseTupleAndKeywords (args, kwargs, "O|O:Async.add_done_callback",
+                                      kwlist, &callback, &context))
+        return NULL;
+
+    if (self->done) {
+        _pygi_async_call_callback (self, callback, context);
+        Py_RETURN_NONE;
+    }
+
+    if (self->callbacks == NULL) {
+        self->callbacks = PyList_New (0);
+        if (self->callbacks == NULL)
+            return NULL;
+    }
+
+    item = PyTuple_Pack (2, callback, context);
+    if (item == NULL || PyList_Append (self->callbacks, item) < 0) {
+        Py_XDECREF (item);
+        return NULL;
+    }
+    Py_DECREF (item);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+_pygi_async_remove_done_callback (PyGIAsync *self, PyObject *callback)
+{
+    Py_ssize_t i, n_removed = 0;
+
+    if (self->callbacks == NULL)
+        return PyLong_FromSsize_t (0);
+
+    for (i = PyList_GET_SIZE (self->callbacks) - 1; i >= 0; i--) {
+        PyObject *item = PyList_GET_ITEM (self->callbacks, i);
+        int equal = PyObject_RichCompareBool (PyTuple_GET_ITEM (item, 0),
+                                              callback, Py_EQ);
+        if (equal < 0)
+            return NULL;
+        if (equal) {
+            if (PySequence_DelItem (self->callbacks, i) < 0)
+                return NULL;
+            n_removed++;
+        }
+    }
+
+    return PyLong_FromSsize_t (n_removed);
+}
+
+static PyObject *
+_pygi_async_get_loop (PyGIAsync *self)
+{
+    PyObject *asyncio, *loop;
+
+    if (self->loop != NULL) {
+        Py_INCREF (self->loop);
+        return self->loop;
+    }
+
+    asyncio = PyImport_ImportModule ("asyncio");
+    if (asyncio == NULL)
+        return NULL;
+    loop = PyObject_CallMethod (asyncio, "get_event_loop", NULL);
+    Py_DECREF (asyncio);
+    return loop;
+}
+
+/* The object is its own iterator for "await", it yields itself until the
+ * operation is done, see asyncio.Future.__await__(). */
+static PyObject *
+_pygi_async_await (PyGIAsync *self)
+{
+    Py_INCREF (self);
+    return (PyObject *) self;
+}
+
+static PyObject *
+_pygi_async_iternext (PyGIAsync *self)
+{
+    PyObject *result, *stop;
+
+    if (!self->done) {
+        self->asyncio_future_blocking = TRUE;
+        Py_INCREF (self);
+        return (PyObject *) self;
+    }
+
+    result = _pygi_async_result (self);
+    if (result == NULL)
+        return NULL;
+
+    /* wrap the result so tuples are not taken as the exception args */
+    stop = PyObject_CallFunctionObjArgs (PyExc_StopIteration, result, NULL);
+    Py_DECREF (result);
+    if (stop != NULL) {
+        PyErr_SetObject (PyExc_StopIteration, stop);
+        Py_DECREF (stop);
+    }
+    return NULL;
+}
+
+static PyObject *
+_pygi_async_repr (PyGIAsync *self)
+{
+    const char *state;
+
+    if (self->cancelled)
+        state = "cancelled";
+    else if (self->done)
+        state = "finished";
+    else
+        state = "pending";
+
+    return PYGLIB_PyUnicode_FromFormat ("<%s object at %p (%s)>",
+                                        Py_TYPE (self)->tp_name, self, state);
+}
+
+static int
+_pygi_async_traverse (PyGIAsync *self, visitproc visit, void *arg)
+{
+    Py_VISIT (self->finish_func);
+    Py_VISIT (self->finish_class);
+    Py_VISIT (self->cancellable);
+    Py_VISIT (self->loop);
+    Py_VISIT (self->result);
+    Py_VISIT (self->exception);
+    Py_VISIT (self->callbacks);
+    return 0;
+}
+
+static int
+_pygi_async_clear (PyGIAsync *self)
+{
+    Py_CLEAR (self->finish_func);
+    Py_CLEAR (self->finish_class);
+    Py_CLEAR (self->cancellable);
+    Py_CLEAR (self->loop);
+    Py_CLEAR (self->result);
+    Py_CLEAR (self->exception);
+    Py_CLEAR (self->callbacks);
+    return 0;
+}
+
+static void
+_pygi_async_dealloc (PyGIAsync *self)
+{
+    PyObject_GC_UnTrack ((PyObject *) self);
+    _pygi_async_clear (self);
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+static PyMethodDef _pygi_async_methods[] = {
+    { "result", (PyCFunction) _pygi_async_result, METH_NOARGS },
+    { "exception", (PyCFunction) _pygi_async_exception, METH_NOARGS },
+    { "done", (PyCFunction) _pygi_async_done, METH_NOARGS },
+    { "cancelled", (PyCFunction) _pygi_async_cancelled, METH_NOARGS },
+    { "cancel", (PyCFunction) _pygi_async_cancel, METH_VARARGS | METH_KEYWORDS },
+    { "add_done_callback", (PyCFunction) _pygi_async_add_done_callback, METH_VARARGS | METH_KEYWORDS },
+    { "remove_done_callback", (PyCFunction) _pygi_async_remove_done_callback, METH_O },
+    { "get_loop", (PyCFunction) _pygi_async_get_loop, METH_NOARGS },
+    { "__await__", (PyCFunction) _pygi_async_await, METH_NOARGS },
+    { NULL, NULL, 0 }
+};
+
+static PyMemberDef _pygi_async_members[] = {
+    { "_asyncio_future_blocking", T_BOOL,
+      offsetof (PyGIAsync, asyncio_future_blocking), 0 },
+    { "cancellable", T_OBJECT, offsetof (PyGIAsync, cancellable), READONLY },
+    { NULL }
+};
+
+#if PY_VERSION_HEX >= 0x03050000
+static PyAsyncMethods _pygi_async_as_async = {
+    (unaryfunc) _pygi_async_await,
+};
+#endif
+
+void
+pygi_async_register_types (PyObject *m)
+{
+    Py_TYPE(&PyGIAsync_Type) = &PyType_Type;
+    PyGIAsync_Type.tp_flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC);
+    PyGIAsync_Type.tp_dealloc = (destructor) _pygi_async_dealloc;
+    PyGIAsync_Type.tp_traverse = (traverseproc) _pygi_async_traverse;
+    PyGIAsync_Type.tp_clear = (inquiry) _pygi_async_clear;
+    PyGIAsync_Type.tp_repr = (reprfunc) _pygi_async_repr;
+    PyGIAsync_Type.tp_iternext = (iternextfunc) _pygi_async_iternext;
+    PyGIAsync_Type.tp_methods = _pygi_async_methods;
+    PyGIAsync_Type.tp_members = _pygi_async_members;
+#if PY_VERSION_HEX >= 0x03050000
+    PyGIAsync_Type.tp_as_async = &_pygi_async_as_async;
+#else
+    /* for "yield from" in Python 3.4 coroutines */
+    PyGIAsync_Type.tp_iter = (getiterfunc) _pygi_async_await;
+#endif
+
+    if (PyType_Ready (&PyGIAsync_Type))
+        return;
+    if (PyModule_AddObject (m, "Async", (PyObject *) &PyGIAsync_Type))
+        return;
+}
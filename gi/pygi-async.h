@@ -0,0 +1,56 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PYGI_ASYNC_H__
+#define __PYGI_ASYNC_H__
+
+#include <Python.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *finish_func;
+    gboolean finish_is_method;
+    PyObject *finish_class;
+    PyObject *cancellable;
+    PyObject *loop;
+    PyObject *result;
+    PyObject *exception;
+    PyObject *callbacks;
+    gboolean done;
+    gboolean cancelled;
+    char asyncio_future_blocking;
+} PyGIAsync;
+
+extern PyTypeObject PyGIAsync_Type;
+
+PyObject *pygi_async_new       (PyObject *finish_func,
+                                gboolean  finish_is_method,
+                                PyObject *finish_class,
+                                PyObject *cancellable);
+
+void      pygi_async_finish_cb (GObject  *source_object,
+                                gpointer  res,
+                                gpointer  user_data);
+
+void      pygi_async_register_types (PyObject *m);
+
+G_END_DECLS
+
+#endif /*__PYGI_ASYNC_H__*/
@@ -708,21 +708,235 @@ pygi_callable_cache_free (PyGICallableCache *cache)
 static PyObject *
 _function_cache_invoke_real (PyGIFunctionCache *function_cache,
                              PyGIInvokeState *state,
-                             PyObject *py_args,
+                             PyObject **py_args,
+                             Py_ssize_t n_py_args,
                              PyObject *py_kwargs)
 {
     return pygi_invoke_c_callable (function_cache, state,
-                                   py_args, py_kwargs);
+                                   py_args, n_py_args, py_kwargs);
 }
 
 static void
 _function_cache_deinit_real (PyGICallableCache *callable_cache)
 {
     g_function_invoker_destroy (&((PyGIFunctionCache *) callable_cache)->invoker);
+    Py_CLEAR (((PyGIFunctionCache *) callable_cache)->async_finish);
+    Py_CLEAR (((PyGIFunctionCache *) callable_cache)->async_finish_class);
 
     _callable_cache_deinit_real (callable_cache);
 }
 
+static gboolean
+_is_gio_interface (GITypeInfo *type_info, GIInfoType info_type, const gchar *name)
+{
+    GIBaseInfo *iface_info;
+    gboolean result;
+
+    if (g_type_info_get_tag (type_info) != GI_TYPE_TAG_INTERFACE)
+        return FALSE;
+
+    iface_info = g_type_info_get_interface (type_info);
+    result = g_base_info_get_type (iface_info) == info_type &&
+             strcmp (g_base_info_get_namespace (iface_info), "Gio") == 0 &&
+             strcmp (g_base_info_get_name (iface_info), name) == 0;
+    g_base_info_unref (iface_info);
+
+    return result;
+}
+
+/* Symbol name -> PyGIGILPolicy set with pygi_function_info_set_gil_policy() */
+static GHashTable *gil_policy_overrides = NULL;
+
+static const gchar *gil_keep_prefixes[] = { "get_", "is_", "has_", NULL };
+
+/* _function_info_is_accessor:
+ *
+ * Whether the GIL can be kept while calling @info by default. This is
+ * the case for methods named like getters or predicates that take no
+ * arguments other than the instance and cannot fail. Anything taking
+ * arguments could block (e.g. a timeout) and wait on a thread that
+ * needs the GIL, so it keeps releasing it.
+ */
+static gboolean
+_function_info_is_accessor (GIFunctionInfo *info)
+{
+    const gchar *name = g_base_info_get_name ((GIBaseInfo *) info);
+    gboolean has_prefix = FALSE;
+    gint i;
+
+    if (!(g_function_info_get_flags (info) & GI_FUNCTION_IS_METHOD) ||
+            g_callable_info_can_throw_gerror ((GICallableInfo *) info))
+        return FALSE;
+
+    for (i = 0; gil_keep_prefixes[i] != NULL; i++) {
+        if (g_str_has_prefix (name, gil_keep_prefixes[i])) {
+            has_prefix = TRUE;
+            break;
+        }
+    }
+    if (!has_prefix)
+        return FALSE;
+
+    for (i = 0; i < g_callable_info_get_n_args ((GICallableInfo *) info); i++) {
+        GIArgInfo *arg_info = g_callable_info_get_arg ((GICallableInfo *) info, i);
+        GIDirection direction = g_arg_info_get_direction (arg_info);
+
+        g_base_info_unref (arg_info);
+        if (direction != GI_DIRECTION_OUT)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * pygi_function_info_set_gil_policy:
+ * @info: the function
+ * @policy: whether to keep or release the GIL while calling @info,
+ *   PYGI_GIL_POLICY_DEFAULT to go back to the built-in rules
+ *
+ * Overrides the GIL policy of all functions with the symbol of @info.
+ * Function caches created later pick it up, existing ones have to be
+ * updated by the caller.
+ */
+void
+pygi_function_info_set_gil_policy (GIFunctionInfo *info,
+                                   PyGIGILPolicy policy)
+{
+    const gchar *symbol = g_function_info_get_symbol (info);
+
+    if (gil_policy_overrides == NULL)
+        gil_policy_overrides = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                      g_free, NULL);
+
+    if (policy == PYGI_GIL_POLICY_DEFAULT)
+        g_hash_table_remove (gil_policy_overrides, symbol);
+    else
+        g_hash_table_insert (gil_policy_overrides, g_strdup (symbol),
+                             GINT_TO_POINTER (policy));
+}
+
+/**
+ * pygi_function_info_keeps_gil:
+ * @info: the function
+ *
+ * Returns: whether the GIL is kept while calling @info.
+ */
+gboolean
+pygi_function_info_keeps_gil (GIFunctionInfo *info)
+{
+    if (gil_policy_overrides != NULL) {
+        PyGIGILPolicy policy = GPOINTER_TO_INT (
+            g_hash_table_lookup (gil_policy_overrides,
+                                 g_function_info_get_symbol (info)));
+
+        if (policy != PYGI_GIL_POLICY_DEFAULT)
+            return policy == PYGI_GIL_POLICY_KEEP;
+    }
+
+    return _function_info_is_accessor (info);
+}
+
+/* _function_cache_setup_async:
+ *
+ * Looks for a Gio.AsyncReadyCallback argument and the *_finish() function
+ * belonging to it, following the GIO naming conventions. Both functions
+ * need to live in the same container, "foo_async" and "foo" are finished
+ * by "foo_finish".
+ */
+static void
+_function_cache_setup_async (PyGIFunctionCache *function_cache,
+                             GICallableInfo *callable_info)
+{
+    PyGICallableCache *callable_cache = (PyGICallableCache *) function_cache;
+    GIBaseInfo *container;
+    GIFunctionInfo *finish_info = NULL;
+    gssize callback_index = -1, user_data_index = -1, cancellable_index = -1;
+    gint i, n_args;
+    const gchar *name;
+    gsize name_len;
+    gchar *finish_name;
+
+    if (g_base_info_get_type ((GIBaseInfo *) callable_info) != GI_INFO_TYPE_FUNCTION ||
+            callable_cache->throws ||
+            g_function_info_get_flags ((GIFunctionInfo *) callable_info) & GI_FUNCTION_IS_CONSTRUCTOR)
+        return;
+
+    n_args = g_callable_info_get_n_args (callable_info);
+    for (i = 0; i < n_args; i++) {
+        GIArgInfo *arg_info = g_callable_info_get_arg (callable_info, i);
+        GITypeInfo *type_info = g_arg_info_get_type (arg_info);
+
+        if (g_arg_info_get_direction (arg_info) == GI_DIRECTION_IN) {
+            if (_is_gio_interface (type_info, GI_INFO_TYPE_CALLBACK, "AsyncReadyCallback") &&
+                    g_arg_info_get_scope (arg_info) == GI_SCOPE_TYPE_ASYNC &&
+                    g_arg_info_get_closure (arg_info) >= 0) {
+                callback_index = i + callable_cache->args_offset;
+                user_data_index = g_arg_info_get_closure (arg_info) + callable_cache->args_offset;
+            } else if (_is_gio_interface (type_info, GI_INFO_TYPE_OBJECT, "Cancellable")) {
+                cancellable_index = i + callable_cache->args_offset;
+            }
+        }
+
+        g_base_info_unref (type_info);
+        g_base_info_unref (arg_info);
+    }
+
+    if (callback_index < 0)
+        return;
+
+    name = g_base_info_get_name ((GIBaseInfo *) callable_info);
+    name_len = strlen (name);
+    if (g_str_has_suffix (name, "_async"))
+        name_len -= strlen ("_async");
+    finish_name = g_strdup_printf ("%.*s_finish", (int) name_len, name);
+
+    container = g_base_info_get_container ((GIBaseInfo *) callable_info);
+    if (container == NULL)
+        finish_info = (GIFunctionInfo *) g_irepository_find_by_name (NULL,
+                                                                     g_base_info_get_namespace ((GIBaseInfo *) callable_info),
+                                                                     finish_name);
+    else if (g_base_info_get_type (container) == GI_INFO_TYPE_OBJECT)
+        finish_info = g_object_info_find_method ((GIObjectInfo *) container, finish_name);
+    else if (g_base_info_get_type (container) == GI_INFO_TYPE_INTERFACE)
+        finish_info = g_interface_info_find_method ((GIInterfaceInfo *) container, finish_name);
+
+    g_free (finish_name);
+
+    if (finish_info == NULL)
+        return;
+
+    if (g_base_info_get_type ((GIBaseInfo *) finish_info) == GI_INFO_TYPE_FUNCTION) {
+        GIFunctionInfoFlags flags = g_function_info_get_flags (finish_info);
+
+        /* Constructors like g_dbus_proxy_new_finish() are invoked with the
+         * class as first argument. */
+        if (flags & GI_FUNCTION_IS_CONSTRUCTOR) {
+            function_cache->async_finish_class =
+                _pygi_type_import_by_gi_info (g_base_info_get_container ((GIBaseInfo *) finish_info));
+            if (function_cache->async_finish_class == NULL) {
+                /* not fatal, the function can still be called with a callback */
+                PyErr_Clear ();
+                g_base_info_unref ((GIBaseInfo *) finish_info);
+                return;
+            }
+        }
+
+        function_cache->async_finish = _pygi_info_new ((GIBaseInfo *) finish_info);
+        if (function_cache->async_finish == NULL) {
+            PyErr_Clear ();
+            Py_CLEAR (function_cache->async_finish_class);
+        } else {
+            function_cache->async_finish_is_method = (flags & GI_FUNCTION_IS_METHOD) != 0;
+            function_cache->async_callback_index = callback_index;
+            function_cache->async_user_data_index = user_data_index;
+            function_cache->async_cancellable_index = cancellable_index;
+        }
+    }
+
+    g_base_info_unref ((GIBaseInfo *) finish_info);
+}
+
 static gboolean
 _function_cache_init (PyGIFunctionCache *function_cache,
                       GICallableInfo *callable_info)
@@ -747,6 +961,9 @@ _function_cache_init (PyGIFunctionCache *function_cache,
         if (g_function_info_prep_invoker ((GIFunctionInfo *) callable_info,
                                           invoker,
                                           &error)) {
+            _function_cache_setup_async (function_cache, callable_info);
+            function_cache->keep_gil =
+                pygi_function_info_keeps_gil ((GIFunctionInfo *) callable_info);
             return TRUE;
         }
     } else {
@@ -785,13 +1002,14 @@ pygi_function_cache_new (GICallableInfo *info)
 
 PyObject *
 pygi_function_cache_invoke (PyGIFunctionCache *function_cache,
-                            PyObject *py_args,
+                            PyObject **py_args,
+                            Py_ssize_t n_py_args,
                             PyObject *py_kwargs)
 {
     PyGIInvokeState state = { 0, };
 
     return function_cache->invoke (function_cache, &state,
-                                   py_args, py_kwargs);
+                                   py_args, n_py_args, py_kwargs);
 }
 
 /* PyGICCallbackCache */
@@ -818,7 +1036,8 @@ pygi_ccallback_cache_new (GICallableInfo *info,
 
 PyObject *
 pygi_ccallback_cache_invoke (PyGICCallbackCache *ccallback_cache,
-                             PyObject *py_args,
+                             PyObject **py_args,
+                             Py_ssize_t n_py_args,
                              PyObject *py_kwargs,
                              gpointer user_data)
 {
@@ -828,7 +1047,7 @@ pygi_ccallback_cache_invoke (PyGICCallbackCache *ccallback_cache,
     state.user_data = user_data;
 
     return function_cache->invoke (function_cache, &state,
-                                   py_args, py_kwargs);
+                                   py_args, n_py_args, py_kwargs);
 }
 
 /* PyGIConstructorCache */
@@ -836,16 +1055,14 @@ pygi_ccallback_cache_invoke (PyGICCallbackCache *ccallback_cache,
 static PyObject *
 _constructor_cache_invoke_real (PyGIFunctionCache *function_cache,
                                 PyGIInvokeState *state,
-                                PyObject *py_args,
+                                PyObject **py_args,
+                                Py_ssize_t n_py_args,
                                 PyObject *py_kwargs)
 {
     PyGICallableCache *cache = (PyGICallableCache *) function_cache;
-    PyObject *constructor_class;
     PyObject *ret;
 
-    constructor_class = PyTuple_GetItem (py_args, 0);
-    if (constructor_class == NULL) {
-        PyErr_Clear ();
+    if (n_py_args < 1) {
         PyErr_Format (PyExc_TypeError,
                       "Constructors require the class to be passed in as an argument, "
                       "No arguments passed to the %s constructor.",
@@ -854,10 +1071,10 @@ _constructor_cache_invoke_real (PyGIFunctionCache *function_cache,
         return FALSE;
     }
 
-    py_args = PyTuple_GetSlice (py_args, 1, PyTuple_Size (py_args));
+    /* Skip the class argument. */
     ret = _function_cache_invoke_real (function_cache, state,
-                                       py_args, py_kwargs);
-    Py_DECREF (py_args);
+                                       py_args + 1, n_py_args - 1,
+                                       py_kwargs);
 
     if (ret == NULL || cache->return_cache->is_skipped)
         return ret;
@@ -967,23 +1184,21 @@ pygi_method_cache_new (GICallableInfo *info)
 static PyObject *
 _vfunc_cache_invoke_real (PyGIFunctionCache *function_cache,
                           PyGIInvokeState *state,
-                          PyObject *py_args,
+                          PyObject **py_args,
+                          Py_ssize_t n_py_args,
                           PyObject *py_kwargs)
 {
     PyGIVFuncCache *vfunc_cache = (PyGIVFuncCache *) function_cache;
-    PyObject *py_gtype;
     GType implementor_gtype;
     GError *error = NULL;
-    PyObject *ret;
 
-    py_gtype = PyTuple_GetItem (py_args, 0);
-    if (py_gtype == NULL) {
+    if (n_py_args < 1) {
         PyErr_SetString (PyExc_TypeError,
                          "need the GType of the implementor class");
         return FALSE;
     }
 
-    implementor_gtype = pyg_type_from_object (py_gtype);
+    implementor_gtype = pyg_type_from_object (py_args[0]);
     if (implementor_gtype == G_TYPE_INVALID)
         return FALSE;
 
@@ -999,12 +1214,10 @@ _vfunc_cache_invoke_real (PyGIFunctionCache *function_cache,
         return FALSE;
     }
 
-    py_args = PyTuple_GetSlice (py_args, 1, PyTuple_Size (py_args));
-    ret = _function_cache_invoke_real (function_cache, state,
-                                       py_args, py_kwargs);
-    Py_DECREF (py_args);
-
-    return ret;
+    /* Skip the implementor GType argument. */
+    return _function_cache_invoke_real (function_cache, state,
+                                        py_args + 1, n_py_args - 1,
+                                        py_kwargs);
 }
 
 static void
@@ -97,6 +97,16 @@ typedef enum {
     PYGI_CALLING_CONTEXT_IS_FROM_PY
 } PyGICallingContext;
 
+/*
+ * Whether the GIL is released while calling a function, see
+ * pygi_function_info_set_gil_policy().
+ */
+typedef enum {
+    PYGI_GIL_POLICY_DEFAULT,
+    PYGI_GIL_POLICY_KEEP,
+    PYGI_GIL_POLICY_RELEASE
+} PyGIGILPolicy;
+
 
 struct _PyGIArgCache
 {
@@ -143,6 +153,8 @@ typedef struct _PyGIArgGArray
     gboolean is_zero_terminated;
     gsize item_size;
     GIArrayType array_type;
+    /* Namespace of the callable, for pygi_array_buffers_enabled() */
+    const gchar *namespace_;
 } PyGIArgGArray;
 
 typedef struct _PyGIInterfaceCache
@@ -203,9 +215,23 @@ struct _PyGIFunctionCache {
     /* An invoker with ffi_cif already setup */
     GIFunctionInvoker invoker;
 
+    /* Set for GIO style *_async() functions with a matching *_finish()
+     * function, the PyGIFunctionInfo of the latter. Calling the function
+     * without a callback returns a gi.Async. */
+    PyObject *async_finish;
+    gboolean async_finish_is_method;
+    PyObject *async_finish_class;   /* set if the former is a constructor */
+    gssize async_callback_index;
+    gssize async_user_data_index;
+    gssize async_cancellable_index;
+
+    /* Call without releasing the GIL, set for cheap accessors. */
+    gboolean keep_gil;
+
     PyObject *(*invoke) (PyGIFunctionCache *function_cache,
                          PyGIInvokeState *state,
-                         PyObject *py_args,
+                         PyObject **py_args,
+                         Py_ssize_t n_py_args,
                          PyObject *py_kwargs);
 } ;
 
@@ -270,7 +296,8 @@ pygi_function_cache_new     (GICallableInfo *info);
 
 PyObject *
 pygi_function_cache_invoke  (PyGIFunctionCache *function_cache,
-                             PyObject *py_args,
+                             PyObject **py_args,
+                             Py_ssize_t n_py_args,
                              PyObject *py_kwargs);
 
 PyGIFunctionCache *
@@ -279,7 +306,8 @@ pygi_ccallback_cache_new    (GICallableInfo *info,
 
 PyObject *
 pygi_ccallback_cache_invoke (PyGIFunctionCache *function_cache,
-                             PyObject *py_args,
+                             PyObject **py_args,
+                             Py_ssize_t n_py_args,
                              PyObject *py_kwargs,
                              gpointer user_data);
 
@@ -295,6 +323,13 @@ pygi_vfunc_cache_new        (GICallableInfo *info);
 PyGIClosureCache *
 pygi_closure_cache_new      (GICallableInfo *info);
 
+void
+pygi_function_info_set_gil_policy (GIFunctionInfo *info,
+                                   PyGIGILPolicy policy);
+
+gboolean
+pygi_function_info_keeps_gil      (GIFunctionInfo *info);
+
 #define _pygi_callable_cache_args_len(cache) ((cache)->args_cache)->len
 
 inline static PyGIArgCache *
@@ -39,7 +39,8 @@ _ccallback_call(PyGICCallback *self, PyObject *args, PyObject *kwargs)
     }
 
     result = pygi_ccallback_cache_invoke (self->cache,
-                                          args,
+                                          PySequence_Fast_ITEMS (args),
+                                          PyTuple_GET_SIZE (args),
                                           kwargs,
                                           self->user_data);
     return result;
@@ -203,14 +203,14 @@ _pygi_closure_assign_pyobj_to_out_argument (gpointer out_arg,
       }
 }
 
-static GIArgument *
-_pygi_closure_convert_ffi_arguments (PyGICallableCache *cache, void **args)
+static void
+_pygi_closure_convert_ffi_arguments (PyGICallableCache *cache,
+                                     void             **args,
+                                     GIArgument        *g_args)
 {
     gint num_args, i;
-    GIArgument *g_args;
 
     num_args = _pygi_callable_cache_args_len (cache);
-    g_args = g_new0 (GIArgument, num_args);
 
     for (i = 0; i < num_args; i++) {
         PyGIArgCache *arg_cache = g_ptr_array_index (cache->args_cache, i);
@@ -292,9 +292,11 @@ _pygi_closure_convert_ffi_arguments (PyGICallableCache *cache, void **args)
             }
         }
     }
-    return g_args;
 }
 
+#define _invoke_state_args_block_size(n_args) \
+    ((n_args) * (2 * sizeof (GIArgument) + sizeof (gpointer)))
+
 static gboolean
 _invoke_state_init_from_cache (PyGIInvokeState *state,
                                PyGIClosureCache *closure_cache,
@@ -304,37 +306,35 @@ _invoke_state_init_from_cache (PyGIInvokeState *state,
 
     state->n_args = _pygi_callable_cache_args_len (cache);
 
-    state->py_in_args = PyTuple_New (state->n_args);
-    if (state->py_in_args == NULL) {
-        PyErr_NoMemory ();
-        return FALSE;
-    }
-    state->n_py_in_args = state->n_args;
-
     if (cache->throws) {
         state->n_args++;
     }
 
     state->args = NULL;
 
-    state->args_cleanup_data = g_slice_alloc0 (state->n_args * sizeof (gpointer));
-    if (state->args_cleanup_data == NULL && state->n_args != 0) {
-        PyErr_NoMemory();
-        return FALSE;
-    }
+    if (state->n_args <= PYGI_INVOKE_STATE_N_STACK_ARGS) {
+        state->args_cleanup_data = state->stack_args_cleanup_data;
+        state->arg_values = state->stack_arg_values;
+        state->arg_pointers = state->stack_arg_pointers;
 
-    state->arg_values = _pygi_closure_convert_ffi_arguments (cache, args);
-    if (state->arg_values == NULL && state->n_args != 0) {
-        PyErr_NoMemory ();
-        return FALSE;
-    }
+        memset (state->args_cleanup_data, 0, state->n_args * sizeof (gpointer));
+        memset (state->arg_values, 0, state->n_args * sizeof (GIArgument));
+        memset (state->arg_pointers, 0, state->n_args * sizeof (GIArgument));
+    } else {
+        guint8 *block = g_slice_alloc0 (_invoke_state_args_block_size (state->n_args));
 
-    state->arg_pointers = g_slice_alloc0 (state->n_args * sizeof(GIArgument));
-    if (state->arg_pointers == NULL && state->n_args != 0) {
-        PyErr_NoMemory ();
-        return FALSE;
+        if (block == NULL) {
+            PyErr_NoMemory ();
+            return FALSE;
+        }
+
+        state->arg_values = (GIArgument *) block;
+        state->arg_pointers = state->arg_values + state->n_args;
+        state->args_cleanup_data = (gpointer *) (state->arg_pointers + state->n_args);
     }
 
+    _pygi_closure_convert_ffi_arguments (cache, args, state->arg_values);
+
     state->error = NULL;
 
     if (cache->throws) {
@@ -350,21 +350,46 @@ _invoke_state_init_from_cache (PyGIInvokeState *state,
 static void
 _invoke_state_clear (PyGIInvokeState *state)
 {
-    g_slice_free1 (state->n_args * sizeof(gpointer), state->args_cleanup_data);
-    g_free (state->arg_values);
-    g_slice_free1 (state->n_args * sizeof(GIArgument), state->arg_pointers);
+    if (state->arg_values != NULL && state->arg_values != state->stack_arg_values)
+        g_slice_free1 (_invoke_state_args_block_size (state->n_args),
+                       state->arg_values);
+
+    if (state->py_in_args_owned) {
+        gssize i;
+
+        for (i = 0; i < state->n_py_in_args; i++)
+            Py_XDECREF (state->py_in_args[i]);
 
-    Py_XDECREF (state->py_in_args);
+        if (state->py_in_args != state->stack_py_in_args)
+            g_free (state->py_in_args);
+    }
 }
 
+/* _pygi_closure_convert_arguments:
+ *
+ * Marshals the C arguments of the closure to Python into state->py_in_args,
+ * which is owned by the state.
+ */
 static gboolean
 _pygi_closure_convert_arguments (PyGIInvokeState *state,
                                  PyGIClosureCache *closure_cache)
 {
     PyGICallableCache *cache = (PyGICallableCache *) closure_cache;
-    gssize n_in_args = 0;
+    gssize max_py_args;
     gssize i;
 
+    /* user_data is expanded into variable args */
+    max_py_args = _pygi_callable_cache_args_len (cache);
+    if (state->user_data != NULL && PyTuple_Check (state->user_data))
+        max_py_args += PyTuple_GET_SIZE (state->user_data);
+
+    if (max_py_args <= PYGI_INVOKE_STATE_N_STACK_ARGS)
+        state->py_in_args = state->stack_py_in_args;
+    else
+        state->py_in_args = g_new (PyObject *, max_py_args);
+    state->n_py_in_args = 0;
+    state->py_in_args_owned = TRUE;
+
     /* Must set all the arg_pointers and update the arg_values before
      * marshaling otherwise out args wouldn't have the correct values.
      */
@@ -408,14 +433,11 @@ _pygi_closure_convert_arguments (PyGIInvokeState *state,
                         return FALSE;
                     }
 
-                    user_data_len = PyTuple_Size (py_user_data);
-                    _PyTuple_Resize (&state->py_in_args,
-                                     state->n_py_in_args + user_data_len - 1);
-
-                    for (j = 0; j < user_data_len; j++, n_in_args++) {
-                        value = PyTuple_GetItem (py_user_data, j);
+                    user_data_len = PyTuple_GET_SIZE (py_user_data);
+                    for (j = 0; j < user_data_len; j++) {
+                        value = PyTuple_GET_ITEM (py_user_data, j);
                         Py_INCREF (value);
-                        PyTuple_SET_ITEM (state->py_in_args, n_in_args, value);
+                        state->py_in_args[state->n_py_in_args++] = value;
                     }
                     /* We can assume user_data args are never going to be inout,
                      * so just continue here.
@@ -438,17 +460,41 @@ _pygi_closure_convert_arguments (PyGIInvokeState *state,
                 }
             }
 
-            PyTuple_SET_ITEM (state->py_in_args, n_in_args, value);
-            n_in_args++;
+            state->py_in_args[state->n_py_in_args++] = value;
         }
     }
 
-    if (_PyTuple_Resize (&state->py_in_args, n_in_args) == -1)
-        return FALSE;
-
     return TRUE;
 }
 
+/* _pygi_closure_call:
+ *
+ * Calls the Python function of @closure with the arguments in @state. The
+ * argument tuple is built per call, small tuples come from the tuple
+ * free list so this does not hit the allocator.
+ */
+static PyObject *
+_pygi_closure_call (PyGICClosure *closure, PyGIInvokeState *state)
+{
+    PyObject *py_args;
+    PyObject *retval;
+    gssize i;
+
+    py_args = PyTuple_New (state->n_py_in_args);
+    if (py_args == NULL)
+        return NULL;
+
+    for (i = 0; i < state->n_py_in_args; i++) {
+        Py_INCREF (state->py_in_args[i]);
+        PyTuple_SET_ITEM (py_args, i, state->py_in_args[i]);
+    }
+
+    retval = PyObject_Call (closure->function, py_args, NULL);
+
+    Py_DECREF (py_args);
+    return retval;
+}
+
 static gboolean
 _pygi_closure_set_out_arguments (PyGIInvokeState *state,
                                  PyGICallableCache *cache,
@@ -572,7 +618,10 @@ _pygi_closure_handle (ffi_cif *cif,
 
     state.user_data = closure->user_data;
 
-    _invoke_state_init_from_cache (&state, closure->cache, args);
+    if (!_invoke_state_init_from_cache (&state, closure->cache, args)) {
+        PyErr_Print ();
+        goto end;
+    }
 
     if (!_pygi_closure_convert_arguments (&state, closure->cache)) {
         if (PyErr_Occurred ())
@@ -580,7 +629,7 @@ _pygi_closure_handle (ffi_cif *cif,
         goto end;
     }
 
-    retval = PyObject_CallObject ( (PyObject *) closure->function, state.py_in_args);
+    retval = _pygi_closure_call (closure, &state);
 
     if (retval == NULL) {
         _pygi_closure_clear_retval (closure->cache, result);
@@ -713,9 +762,7 @@ _pygi_marshal_from_py_interface_callback (PyGIInvokeState   *state,
         user_data_cache = _pygi_callable_cache_get_arg (callable_cache, callback_cache->user_data_index);
         if (user_data_cache->py_arg_index < state->n_py_in_args) {
             /* py_user_data is a borrowed reference. */
-            py_user_data = PyTuple_GetItem (state->py_in_args, user_data_cache->py_arg_index);
-            if (!py_user_data)
-                return FALSE;
+            py_user_data = state->py_in_args[user_data_cache->py_arg_index];
             /* NULL out user_data if it was not supplied and the default arg placeholder
              * was used instead.
              */
@@ -22,6 +22,7 @@
 
 #include "pygi-private.h"
 #include "pygi-cache.h"
+#include "pygi-basictype.h"
 #include "pygobject-private.h"
 
 #include <pyglib-python-compat.h>
@@ -278,11 +279,11 @@ _wrap_g_base_info_get_type (PyGIBaseInfo *self)
 }
 
 static PyObject *
-_wrap_g_base_info_get_name (PyGIBaseInfo *self)
+_base_info_get_py_name (GIBaseInfo *info)
 {
     const gchar *name;
 
-    name = _safe_base_info_get_name (self->info);
+    name = _safe_base_info_get_name (info);
 
     /* escape keywords */
     if (_pygi_is_python_keyword (name)) {
@@ -295,6 +296,12 @@ _wrap_g_base_info_get_name (PyGIBaseInfo *self)
     return PYGLIB_PyUnicode_FromString (name);
 }
 
+static PyObject *
+_wrap_g_base_info_get_name (PyGIBaseInfo *self)
+{
+    return _base_info_get_py_name (self->info);
+}
+
 static PyObject *
 _wrap_g_base_info_get_name_unescaped (PyGIBaseInfo *self)
 {
@@ -533,30 +540,30 @@ PYGLIB_DEFINE_TYPE ("gi.CallableInfo", PyGICallableInfo_Type, PyGICallableInfo);
 static PyObject *
 _callable_info_call (PyGICallableInfo *self, PyObject *args, PyObject *kwargs)
 {
-    /* Insert the bound arg at the beginning of the invoke method args. */
+    /* Insert the bound arg at the beginning of the invoke method args.
+     * The arguments are passed on as a C array of borrowed references, which
+     * avoids building a new tuple for every bound method call.
+     */
     if (self->py_bound_arg) {
-        int i;
+        PyObject *stack_args[PYGI_INVOKE_STATE_N_STACK_ARGS];
+        PyObject **newargs = stack_args;
         PyObject *result;
-        Py_ssize_t argcount = PyTuple_Size (args);
-        PyObject *newargs = PyTuple_New (argcount + 1);
-        if (newargs == NULL)
-            return NULL;
+        Py_ssize_t argcount = PyTuple_GET_SIZE (args);
 
-        Py_INCREF (self->py_bound_arg);
-        PyTuple_SET_ITEM (newargs, 0, self->py_bound_arg);
+        if (argcount + 1 > PYGI_INVOKE_STATE_N_STACK_ARGS)
+            newargs = g_new (PyObject *, argcount + 1);
 
-        for (i = 0; i < argcount; i++) {
-            PyObject *v = PyTuple_GET_ITEM (args, i);
-            Py_XINCREF (v);
-            PyTuple_SET_ITEM (newargs, i+1, v);
-        }
+        newargs[0] = self->py_bound_arg;
+        memcpy (newargs + 1, PySequence_Fast_ITEMS (args),
+                argcount * sizeof (PyObject *));
 
         /* Invoke with the original GI info struct this wrapper was based upon.
          * This is necessary to maintain the same cache for all bound versions.
          */
-        result = _wrap_g_callable_info_invoke ((PyGIBaseInfo *)self->py_unbound_info,
-                                               newargs, kwargs);
-        Py_DECREF (newargs);
+        result = pygi_callable_info_invoke ((PyGIBaseInfo *)self->py_unbound_info,
+                                            newargs, argcount + 1, kwargs);
+        if (newargs != stack_args)
+            g_free (newargs);
         return result;
 
     } else {
@@ -1290,6 +1297,12 @@ _wrap_g_struct_info_get_methods (PyGIBaseInfo *self)
     return _make_infos_tuple (self, g_struct_info_get_n_methods, g_struct_info_get_method);
 }
 
+static PyObject *
+_wrap_g_struct_info_find_method (PyGIBaseInfo *self, PyObject *py_name)
+{
+    return _get_child_info_by_name (self, py_name, g_struct_info_find_method);
+}
+
 static PyObject *
 _wrap_g_struct_info_get_size (PyGIBaseInfo *self)
 {
@@ -1317,6 +1330,7 @@ _wrap_g_struct_info_is_foreign (PyGIBaseInfo *self)
 static PyMethodDef _PyGIStructInfo_methods[] = {
     { "get_fields", (PyCFunction) _wrap_g_struct_info_get_fields, METH_NOARGS },
     { "get_methods", (PyCFunction) _wrap_g_struct_info_get_methods, METH_NOARGS },
+    { "find_method", (PyCFunction) _wrap_g_struct_info_find_method, METH_O },
     { "get_size", (PyCFunction) _wrap_g_struct_info_get_size, METH_NOARGS },
     { "get_alignment", (PyCFunction) _wrap_g_struct_info_get_alignment, METH_NOARGS },
     { "is_gtype_struct", (PyCFunction) _wrap_g_struct_info_is_gtype_struct, METH_NOARGS },
@@ -1759,7 +1773,24 @@ static PyMethodDef _PyGIValueInfo_methods[] = {
 
 
 /* GIFieldInfo */
-PYGLIB_DEFINE_TYPE ("gi.FieldInfo", PyGIFieldInfo_Type, PyGIBaseInfo);
+typedef struct {
+    PyGIBaseInfo base;
+
+    /* Filled in by _field_info_ensure_cache on first access. */
+    GIBaseInfo *container_info;
+    GIInfoType container_info_type;
+    PyObject *py_container_type;
+    GITypeInfo *type_info;
+    GITypeTag type_tag;
+    gsize offset;
+
+    /* Whether the value is a number loaded or stored with a plain memory
+     * access instead of going through g_field_info_get/set_field. */
+    gboolean direct_get;
+    gboolean direct_set;
+} PyGIFieldInfo;
+
+PYGLIB_DEFINE_TYPE ("gi.FieldInfo", PyGIFieldInfo_Type, PyGIFieldInfo);
 
 static gssize
 _struct_field_array_length_marshal (gsize length_index,
@@ -1812,61 +1843,126 @@ out:
     return array_len;
 }
 
-static PyObject *
-_wrap_g_field_info_get_value (PyGIBaseInfo *self,
-                              PyObject     *args)
+/* _field_info_ensure_cache:
+ *
+ * Looks up everything needed to access the field once, so attribute access
+ * on struct instances doesn't have to walk the introspection data again.
+ */
+static gboolean
+_field_info_ensure_cache (PyGIFieldInfo *self)
 {
-    PyObject *instance;
-    GIBaseInfo *container_info;
-    GIInfoType container_info_type;
-    gpointer pointer;
-    GITypeInfo *field_type_info;
-    GIArgument value;
-    PyObject *py_value = NULL;
-    gboolean free_array = FALSE;
+    GIFieldInfo *field_info = (GIFieldInfo *) ((PyGIBaseInfo *) self)->info;
+    GIFieldInfoFlags flags;
+    gboolean is_direct;
 
-    memset(&value, 0, sizeof(GIArgument));
+    if (self->type_info != NULL)
+        return TRUE;
 
-    if (!PyArg_ParseTuple (args, "O:FieldInfo.get_value", &instance)) {
-        return NULL;
+    self->container_info = g_base_info_get_container ((GIBaseInfo *) field_info);
+    g_assert (self->container_info != NULL);
+    g_base_info_ref (self->container_info);
+    self->container_info_type = g_base_info_get_type (self->container_info);
+
+    if (self->container_info_type == GI_INFO_TYPE_STRUCT &&
+            g_struct_info_is_foreign ((GIStructInfo *) self->container_info)) {
+        self->py_container_type = NULL;
+    } else {
+        GType g_type = g_registered_type_info_get_g_type (
+            (GIRegisteredTypeInfo *) self->container_info);
+
+        if (g_type != G_TYPE_NONE)
+            self->py_container_type = _pygi_type_get_from_g_type (g_type);
+        else
+            self->py_container_type = _pygi_type_import_by_gi_info (self->container_info);
+
+        /* Instances are checked the slow way when the type is unavailable. */
+        if (self->py_container_type == NULL)
+            PyErr_Clear ();
     }
 
-    container_info = g_base_info_get_container (self->info);
-    g_assert (container_info != NULL);
+    self->type_info = g_field_info_get_type (field_info);
+    self->type_tag = g_type_info_get_tag (self->type_info);
+    self->offset = g_field_info_get_offset (field_info);
 
-    /* Check the instance. */
-    if (!_pygi_g_registered_type_info_check_object ( (GIRegisteredTypeInfo *) container_info, TRUE, instance)) {
-        _PyGI_ERROR_PREFIX ("argument 1: ");
-        return NULL;
+    flags = g_field_info_get_flags (field_info);
+    is_direct = !g_type_info_is_pointer (self->type_info);
+    switch (self->type_tag) {
+        case GI_TYPE_TAG_BOOLEAN:
+        case GI_TYPE_TAG_INT8:
+        case GI_TYPE_TAG_UINT8:
+        case GI_TYPE_TAG_INT16:
+        case GI_TYPE_TAG_UINT16:
+        case GI_TYPE_TAG_INT32:
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_INT64:
+        case GI_TYPE_TAG_UINT64:
+        case GI_TYPE_TAG_FLOAT:
+        case GI_TYPE_TAG_DOUBLE:
+            break;
+        default:
+            is_direct = FALSE;
+            break;
+    }
+
+    self->direct_get = is_direct && (flags & GI_FIELD_IS_READABLE);
+    self->direct_set = is_direct && (flags & GI_FIELD_IS_WRITABLE);
+
+    return TRUE;
+}
+
+/* _field_info_get_pointer:
+ *
+ * Checks @instance is an instance of the container of the field and
+ * returns a pointer to its memory, or NULL with an exception set.
+ */
+static gpointer
+_field_info_get_pointer (PyGIFieldInfo *self, PyObject *instance)
+{
+    /* Leave foreign structs, __instancecheck__ and errors to the generic
+     * check. */
+    if (self->py_container_type == NULL ||
+            !PyObject_TypeCheck (instance, (PyTypeObject *) self->py_container_type)) {
+        if (!_pygi_g_registered_type_info_check_object (
+                (GIRegisteredTypeInfo *) self->container_info, TRUE, instance)) {
+            _PyGI_ERROR_PREFIX ("argument 1: ");
+            return NULL;
+        }
     }
 
-    /* Get the pointer to the container. */
-    container_info_type = g_base_info_get_type (container_info);
-    switch (container_info_type) {
+    switch (self->container_info_type) {
         case GI_INFO_TYPE_UNION:
         case GI_INFO_TYPE_STRUCT:
-            pointer = pyg_boxed_get (instance, void);
-            break;
+            return pyg_boxed_get (instance, void);
         case GI_INFO_TYPE_OBJECT:
-            pointer = pygobject_get (instance);
-            break;
+            return pygobject_get (instance);
         default:
             /* Other types don't have fields. */
             g_assert_not_reached();
     }
 
-    /* Get the field's value. */
-    field_type_info = g_field_info_get_type ( (GIFieldInfo *) self->info);
+    return NULL;
+}
+
+static PyObject *
+_field_info_get_value_generic (PyGIFieldInfo *self, gpointer pointer)
+{
+    GIFieldInfo *field_info = (GIFieldInfo *) ((PyGIBaseInfo *) self)->info;
+    GITypeInfo *field_type_info = self->type_info;
+    GIArgument value;
+    PyObject *py_value = NULL;
+    gboolean free_array = FALSE;
+
+    memset(&value, 0, sizeof(GIArgument));
 
     /* A few types are not handled by g_field_info_get_field, so do it here. */
     if (!g_type_info_is_pointer (field_type_info)
-            && g_type_info_get_tag (field_type_info) == GI_TYPE_TAG_INTERFACE) {
+            && self->type_tag == GI_TYPE_TAG_INTERFACE) {
         GIBaseInfo *info;
         GIInfoType info_type;
 
-        if (! (g_field_info_get_flags ( (GIFieldInfo *) self->info) & GI_FIELD_IS_READABLE)) {
+        if (! (g_field_info_get_flags (field_info) & GI_FIELD_IS_READABLE)) {
             PyErr_SetString (PyExc_RuntimeError, "field is not readable");
-            goto out;
+            return NULL;
         }
 
         info = g_type_info_get_interface (field_type_info);
@@ -1878,14 +1974,10 @@ _wrap_g_field_info_get_value (PyGIBaseInfo *self,
         switch (info_type) {
             case GI_INFO_TYPE_UNION:
                 PyErr_SetString (PyExc_NotImplementedError, "getting an union is not supported yet");
-                goto out;
+                return NULL;
             case GI_INFO_TYPE_STRUCT:
             {
-                gsize offset;
-
-                offset = g_field_info_get_offset ( (GIFieldInfo *) self->info);
-
-                value.v_pointer = (char*) pointer + offset;
+                value.v_pointer = (char*) pointer + self->offset;
 
                 goto argument_to_object;
             }
@@ -1895,15 +1987,15 @@ _wrap_g_field_info_get_value (PyGIBaseInfo *self,
         }
     }
 
-    if (!g_field_info_get_field ( (GIFieldInfo *) self->info, pointer, &value)) {
+    if (!g_field_info_get_field (field_info, pointer, &value)) {
         PyErr_SetString (PyExc_RuntimeError, "unable to get the value");
-        goto out;
+        return NULL;
     }
 
-    if (g_type_info_get_tag (field_type_info) == GI_TYPE_TAG_ARRAY) {
+    if (self->type_tag == GI_TYPE_TAG_ARRAY) {
         value.v_pointer = _pygi_argument_to_array (&value,
                                                    _struct_field_array_length_marshal,
-                                                   container_info,
+                                                   self->container_info,
                                                    pointer,
                                                    field_type_info,
                                                    &free_array);
@@ -1916,54 +2008,87 @@ argument_to_object:
         g_array_free (value.v_pointer, FALSE);
     }
 
-out:
-    g_base_info_unref ( (GIBaseInfo *) field_type_info);
-
     return py_value;
 }
 
 static PyObject *
-_wrap_g_field_info_set_value (PyGIBaseInfo *self,
-                              PyObject     *args)
+_field_info_get_value (PyGIFieldInfo *self, PyObject *instance)
 {
-    PyObject *instance;
-    PyObject *py_value;
-    GIBaseInfo *container_info;
-    GIInfoType container_info_type;
     gpointer pointer;
-    GITypeInfo *field_type_info;
     GIArgument value;
-    PyObject *retval = NULL;
 
-    if (!PyArg_ParseTuple (args, "OO:FieldInfo.set_value", &instance, &py_value)) {
+    if (!_field_info_ensure_cache (self))
         return NULL;
-    }
-
-    container_info = g_base_info_get_container (self->info);
-    g_assert (container_info != NULL);
 
-    /* Check the instance. */
-    if (!_pygi_g_registered_type_info_check_object ( (GIRegisteredTypeInfo *) container_info, TRUE, instance)) {
-        _PyGI_ERROR_PREFIX ("argument 1: ");
+    pointer = _field_info_get_pointer (self, instance);
+    if (pointer == NULL)
         return NULL;
-    }
 
-    /* Get the pointer to the container. */
-    container_info_type = g_base_info_get_type (container_info);
-    switch (container_info_type) {
-        case GI_INFO_TYPE_UNION:
-        case GI_INFO_TYPE_STRUCT:
-            pointer = pyg_boxed_get (instance, void);
+    if (!self->direct_get)
+        return _field_info_get_value_generic (self, pointer);
+
+    switch (self->type_tag) {
+        case GI_TYPE_TAG_BOOLEAN:
+            value.v_boolean = G_STRUCT_MEMBER (gboolean, pointer, self->offset) != FALSE;
             break;
-        case GI_INFO_TYPE_OBJECT:
-            pointer = pygobject_get (instance);
+        case GI_TYPE_TAG_INT8:
+            value.v_int8 = G_STRUCT_MEMBER (gint8, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_UINT8:
+            value.v_uint8 = G_STRUCT_MEMBER (guint8, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_INT16:
+            value.v_int16 = G_STRUCT_MEMBER (gint16, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_UINT16:
+            value.v_uint16 = G_STRUCT_MEMBER (guint16, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_INT32:
+            value.v_int32 = G_STRUCT_MEMBER (gint32, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_UINT32:
+            value.v_uint32 = G_STRUCT_MEMBER (guint32, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_INT64:
+            value.v_int64 = G_STRUCT_MEMBER (gint64, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_UINT64:
+            value.v_uint64 = G_STRUCT_MEMBER (guint64, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_FLOAT:
+            value.v_float = G_STRUCT_MEMBER (gfloat, pointer, self->offset);
+            break;
+        case GI_TYPE_TAG_DOUBLE:
+            value.v_double = G_STRUCT_MEMBER (gdouble, pointer, self->offset);
             break;
         default:
-            /* Other types don't have fields. */
-            g_assert_not_reached();
+            g_assert_not_reached ();
+    }
+
+    return _pygi_marshal_to_py_basic_type (&value, self->type_tag, GI_TRANSFER_NOTHING);
+}
+
+static PyObject *
+_wrap_g_field_info_get_value (PyGIFieldInfo *self,
+                              PyObject      *args)
+{
+    PyObject *instance;
+
+    if (!PyArg_ParseTuple (args, "O:FieldInfo.get_value", &instance)) {
+        return NULL;
     }
 
-    field_type_info = g_field_info_get_type ( (GIFieldInfo *) self->info);
+    return _field_info_get_value (self, instance);
+}
+
+static int
+_field_info_set_value_generic (PyGIFieldInfo *self,
+                               gpointer       pointer,
+                               PyObject      *py_value)
+{
+    GIFieldInfo *field_info = (GIFieldInfo *) ((PyGIBaseInfo *) self)->info;
+    GITypeInfo *field_type_info = self->type_info;
+    GIArgument value;
 
     /* Check the value. */
     {
@@ -1971,25 +2096,25 @@ _wrap_g_field_info_set_value (PyGIBaseInfo *self,
 
         retval = _pygi_g_type_info_check_object (field_type_info, py_value, TRUE);
         if (retval < 0) {
-            goto out;
+            return -1;
         }
 
         if (!retval) {
             _PyGI_ERROR_PREFIX ("argument 2: ");
-            goto out;
+            return -1;
         }
     }
 
     /* Set the field's value. */
     /* A few types are not handled by g_field_info_set_field, so do it here. */
     if (!g_type_info_is_pointer (field_type_info)
-            && g_type_info_get_tag (field_type_info) == GI_TYPE_TAG_INTERFACE) {
+            && self->type_tag == GI_TYPE_TAG_INTERFACE) {
         GIBaseInfo *info;
         GIInfoType info_type;
 
-        if (! (g_field_info_get_flags ( (GIFieldInfo *) self->info) & GI_FIELD_IS_WRITABLE)) {
+        if (! (g_field_info_get_flags (field_info) & GI_FIELD_IS_WRITABLE)) {
             PyErr_SetString (PyExc_RuntimeError, "field is not writable");
-            goto out;
+            return -1;
         }
 
         info = g_type_info_get_interface (field_type_info);
@@ -1999,11 +2124,11 @@ _wrap_g_field_info_set_value (PyGIBaseInfo *self,
         switch (info_type) {
             case GI_INFO_TYPE_UNION:
                 PyErr_SetString (PyExc_NotImplementedError, "setting an union is not supported yet");
-                goto out;
+                g_base_info_unref (info);
+                return -1;
             case GI_INFO_TYPE_STRUCT:
             {
                 gboolean is_simple;
-                gsize offset;
                 gssize size;
 
                 is_simple = pygi_g_struct_info_is_simple ( (GIStructInfo *) info);
@@ -2012,25 +2137,23 @@ _wrap_g_field_info_set_value (PyGIBaseInfo *self,
                     PyErr_SetString (PyExc_TypeError,
                                      "cannot set a structure which has no well-defined ownership transfer rules");
                     g_base_info_unref (info);
-                    goto out;
+                    return -1;
                 }
 
                 value = _pygi_argument_from_object (py_value, field_type_info, GI_TRANSFER_NOTHING);
                 if (PyErr_Occurred()) {
                     g_base_info_unref (info);
-                    goto out;
+                    return -1;
                 }
 
-                offset = g_field_info_get_offset ( (GIFieldInfo *) self->info);
                 size = g_struct_info_get_size ( (GIStructInfo *) info);
                 g_assert (size > 0);
 
-                g_memmove ((char*) pointer + offset, value.v_pointer, size);
+                g_memmove ((char*) pointer + self->offset, value.v_pointer, size);
 
                 g_base_info_unref (info);
 
-                retval = Py_None;
-                goto out;
+                return 0;
             }
             default:
                 /* Fallback. */
@@ -2039,39 +2162,152 @@ _wrap_g_field_info_set_value (PyGIBaseInfo *self,
 
         g_base_info_unref (info);
     } else if (g_type_info_is_pointer (field_type_info)
-            && (g_type_info_get_tag (field_type_info) == GI_TYPE_TAG_VOID
-                || g_type_info_get_tag (field_type_info) == GI_TYPE_TAG_UTF8)) {
-        int offset;
+            && (self->type_tag == GI_TYPE_TAG_VOID
+                || self->type_tag == GI_TYPE_TAG_UTF8)) {
         value = _pygi_argument_from_object (py_value, field_type_info, GI_TRANSFER_NOTHING);
         if (PyErr_Occurred()) {
-            goto out;
+            return -1;
         }
 
-        offset = g_field_info_get_offset ((GIFieldInfo *) self->info);
-        G_STRUCT_MEMBER (gpointer, pointer, offset) = (gpointer)value.v_pointer;
+        G_STRUCT_MEMBER (gpointer, pointer, self->offset) = (gpointer)value.v_pointer;
 
-        retval = Py_None;
-        goto out;
+        return 0;
     }
 
     value = _pygi_argument_from_object (py_value, field_type_info, GI_TRANSFER_EVERYTHING);
     if (PyErr_Occurred()) {
-        goto out;
+        return -1;
     }
 
-    if (!g_field_info_set_field ( (GIFieldInfo *) self->info, pointer, &value)) {
+    if (!g_field_info_set_field (field_info, pointer, &value)) {
         _pygi_argument_release (&value, field_type_info, GI_TRANSFER_NOTHING, GI_DIRECTION_IN);
         PyErr_SetString (PyExc_RuntimeError, "unable to set value for field");
-        goto out;
+        return -1;
     }
 
-    retval = Py_None;
+    return 0;
+}
 
-out:
-    g_base_info_unref ( (GIBaseInfo *) field_type_info);
+static int
+_field_info_set_value (PyGIFieldInfo *self,
+                       PyObject      *instance,
+                       PyObject      *py_value)
+{
+    gpointer pointer;
+    gpointer cleanup_data = NULL;
+    GIArgument value;
 
-    Py_XINCREF (retval);
-    return retval;
+    if (!_field_info_ensure_cache (self))
+        return -1;
+
+    pointer = _field_info_get_pointer (self, instance);
+    if (pointer == NULL)
+        return -1;
+
+    if (!self->direct_set || py_value == Py_None)
+        return _field_info_set_value_generic (self, pointer, py_value);
+
+    if (!_pygi_marshal_from_py_basic_type (py_value, &value, self->type_tag,
+                                           GI_TRANSFER_NOTHING, &cleanup_data)) {
+        /* Redo it the slow way for the exact same errors */
+        PyErr_Clear ();
+        return _field_info_set_value_generic (self, pointer, py_value);
+    }
+
+    switch (self->type_tag) {
+        case GI_TYPE_TAG_BOOLEAN:
+            G_STRUCT_MEMBER (gboolean, pointer, self->offset) = value.v_boolean != FALSE;
+            break;
+        case GI_TYPE_TAG_INT8:
+            G_STRUCT_MEMBER (gint8, pointer, self->offset) = value.v_int8;
+            break;
+        case GI_TYPE_TAG_UINT8:
+            G_STRUCT_MEMBER (guint8, pointer, self->offset) = value.v_uint8;
+            break;
+        case GI_TYPE_TAG_INT16:
+            G_STRUCT_MEMBER (gint16, pointer, self->offset) = value.v_int16;
+            break;
+        case GI_TYPE_TAG_UINT16:
+            G_STRUCT_MEMBER (guint16, pointer, self->offset) = value.v_uint16;
+            break;
+        case GI_TYPE_TAG_INT32:
+            G_STRUCT_MEMBER (gint32, pointer, self->offset) = value.v_int32;
+            break;
+        case GI_TYPE_TAG_UINT32:
+            G_STRUCT_MEMBER (guint32, pointer, self->offset) = value.v_uint32;
+            break;
+        case GI_TYPE_TAG_INT64:
+            G_STRUCT_MEMBER (gint64, pointer, self->offset) = value.v_int64;
+            break;
+        case GI_TYPE_TAG_UINT64:
+            G_STRUCT_MEMBER (guint64, pointer, self->offset) = value.v_uint64;
+            break;
+        case GI_TYPE_TAG_FLOAT:
+            G_STRUCT_MEMBER (gfloat, pointer, self->offset) = value.v_float;
+            break;
+        case GI_TYPE_TAG_DOUBLE:
+            G_STRUCT_MEMBER (gdouble, pointer, self->offset) = value.v_double;
+            break;
+        default:
+            g_assert_not_reached ();
+    }
+
+    return 0;
+}
+
+static PyObject *
+_wrap_g_field_info_set_value (PyGIFieldInfo *self,
+                              PyObject      *args)
+{
+    PyObject *instance;
+    PyObject *py_value;
+
+    if (!PyArg_ParseTuple (args, "OO:FieldInfo.set_value", &instance, &py_value)) {
+        return NULL;
+    }
+
+    if (_field_info_set_value (self, instance, py_value) < 0)
+        return NULL;
+
+    Py_RETURN_NONE;
+}
+
+/* FieldInfo objects are installed directly on struct, union and object
+ * classes as data descriptors for their fields (see gi/types.py).
+ */
+static PyObject *
+_field_info_descr_get (PyGIFieldInfo *self, PyObject *instance, PyObject *type)
+{
+    if (instance == NULL || instance == Py_None) {
+        Py_INCREF (self);
+        return (PyObject *) self;
+    }
+
+    return _field_info_get_value (self, instance);
+}
+
+static int
+_field_info_descr_set (PyGIFieldInfo *self, PyObject *instance, PyObject *py_value)
+{
+    if (py_value == NULL) {
+        PyErr_Format (PyExc_AttributeError, "cannot delete field '%s'",
+                      _safe_base_info_get_name (((PyGIBaseInfo *) self)->info));
+        return -1;
+    }
+
+    return _field_info_set_value (self, instance, py_value);
+}
+
+static void
+_field_info_dealloc (PyGIFieldInfo *self)
+{
+    if (self->type_info != NULL) {
+        g_base_info_unref ((GIBaseInfo *) self->type_info);
+        g_base_info_unref (self->container_info);
+        Py_CLEAR (self->py_container_type);
+    }
+
+    PyGIBaseInfo_Type.tp_dealloc ((PyObject *) self);
 }
 
 static PyObject *
@@ -2167,12 +2403,211 @@ _wrap_g_union_info_get_methods (PyGIBaseInfo *self)
     return _make_infos_tuple (self, g_union_info_get_n_methods, g_union_info_get_method);
 }
 
+static PyObject *
+_wrap_g_union_info_find_method (PyGIBaseInfo *self, PyObject *py_name)
+{
+    return _get_child_info_by_name (self, py_name, g_union_info_find_method);
+}
+
 static PyMethodDef _PyGIUnionInfo_methods[] = {
     { "get_fields", (PyCFunction) _wrap_g_union_info_get_fields, METH_NOARGS },
     { "get_methods", (PyCFunction) _wrap_g_union_info_get_methods, METH_NOARGS },
+    { "find_method", (PyCFunction) _wrap_g_union_info_find_method, METH_O },
     { NULL, NULL, 0 }
 };
 
+
+/* LazyMember
+ *
+ * Placeholder installed in the dict of GI classes for each method or
+ * constant. It only records the index of the member in its container
+ * info, so creating a class doesn't need to wrap every member. On first
+ * access the real FunctionInfo or constant value replaces the placeholder
+ * in the class that holds it and is returned in its place.
+ */
+typedef struct {
+    PyObject_HEAD
+    PyGIBaseInfo *container;
+    PyObject *name;
+    gint index;
+    PyGILazyMemberKind kind;
+} PyGILazyMember;
+
+PYGLIB_DEFINE_TYPE ("gi.LazyMember", PyGILazyMember_Type, PyGILazyMember);
+
+static gint
+_lazy_member_get_n_infos (GIBaseInfo *container, PyGILazyMemberKind kind)
+{
+    switch (g_base_info_get_type (container)) {
+        case GI_INFO_TYPE_OBJECT:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return g_object_info_get_n_constants ((GIObjectInfo *) container);
+            return g_object_info_get_n_methods ((GIObjectInfo *) container);
+        case GI_INFO_TYPE_INTERFACE:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return g_interface_info_get_n_constants ((GIInterfaceInfo *) container);
+            return g_interface_info_get_n_methods ((GIInterfaceInfo *) container);
+        case GI_INFO_TYPE_STRUCT:
+        case GI_INFO_TYPE_BOXED:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return 0;
+            return g_struct_info_get_n_methods ((GIStructInfo *) container);
+        case GI_INFO_TYPE_UNION:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return 0;
+            return g_union_info_get_n_methods ((GIUnionInfo *) container);
+        default:
+            return 0;
+    }
+}
+
+static GIBaseInfo *
+_lazy_member_get_info (GIBaseInfo *container, PyGILazyMemberKind kind, gint index)
+{
+    switch (g_base_info_get_type (container)) {
+        case GI_INFO_TYPE_OBJECT:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return g_object_info_get_constant ((GIObjectInfo *) container, index);
+            return g_object_info_get_method ((GIObjectInfo *) container, index);
+        case GI_INFO_TYPE_INTERFACE:
+            if (kind == PYGI_LAZY_MEMBER_CONSTANT)
+                return g_interface_info_get_constant ((GIInterfaceInfo *) container, index);
+            return g_interface_info_get_method ((GIInterfaceInfo *) container, index);
+        case GI_INFO_TYPE_STRUCT:
+        case GI_INFO_TYPE_BOXED:
+            return g_struct_info_get_method ((GIStructInfo *) container, index);
+        case GI_INFO_TYPE_UNION:
+            return g_union_info_get_method ((GIUnionInfo *) container, index);
+        default:
+            g_assert_not_reached ();
+            return NULL;
+    }
+}
+
+static void
+_lazy_member_dealloc (PyGILazyMember *self)
+{
+    Py_XDECREF (self->container);
+    Py_XDECREF (self->name);
+    PyObject_Del ((PyObject *) self);
+}
+
+static PyObject *
+_lazy_member_resolve (PyGILazyMember *self)
+{
+    GIBaseInfo *info;
+    PyObject *py_info, *value;
+
+    info = _lazy_member_get_info (self->container->info, self->kind, self->index);
+    py_info = _pygi_info_new (info);
+    g_base_info_unref (info);
+    if (py_info == NULL)
+        return NULL;
+
+    if (self->kind != PYGI_LAZY_MEMBER_CONSTANT)
+        return py_info;
+
+    value = _wrap_g_constant_info_get_value ((PyGIBaseInfo *) py_info);
+    Py_DECREF (py_info);
+    return value;
+}
+
+static PyObject *
+_lazy_member_descr_get (PyGILazyMember *self, PyObject *obj, PyObject *type)
+{
+    PyObject *value, *mro;
+    descrgetfunc descr_get;
+
+    value = _lazy_member_resolve (self);
+    if (value == NULL)
+        return NULL;
+
+    /* Replace the placeholder in the class holding it, which is not
+     * necessarily the type it was looked up through. */
+    if (type == NULL && obj != NULL)
+        type = (PyObject *) Py_TYPE (obj);
+    mro = type != NULL ? ((PyTypeObject *) type)->tp_mro : NULL;
+    if (mro != NULL) {
+        Py_ssize_t i;
+
+        for (i = 0; i < PyTuple_GET_SIZE (mro); i++) {
+            PyObject *klass = PyTuple_GET_ITEM (mro, i);
+            PyObject *dict = ((PyTypeObject *) klass)->tp_dict;
+
+            if (dict != NULL && PyDict_GetItem (dict, self->name) == (PyObject *) self) {
+                /* self is kept alive by the caller's reference */
+                if (PyObject_SetAttr (klass, self->name, value) < 0) {
+                    Py_DECREF (value);
+                    return NULL;
+                }
+                break;
+            }
+        }
+    }
+
+    descr_get = Py_TYPE (value)->tp_descr_get;
+    if (descr_get != NULL) {
+        PyObject *result = descr_get (value, obj == Py_None ? NULL : obj, type);
+        Py_DECREF (value);
+        return result;
+    }
+
+    return value;
+}
+
+/* _pygi_info_setup_lazy_members:
+ * @cls: the class wrapping @container
+ * @py_container: an object, interface, struct or union info
+ * @kind: whether to install the methods or the constants of @py_container
+ *
+ * Installs a LazyMember placeholder on @cls for each method or constant of
+ * @py_container, replacing existing attributes of the same name.
+ *
+ * Returns: 0 on success, -1 with an exception set otherwise
+ */
+int
+_pygi_info_setup_lazy_members (PyObject *cls,
+                               PyObject *py_container,
+                               PyGILazyMemberKind kind)
+{
+    PyGIBaseInfo *container = (PyGIBaseInfo *) py_container;
+    gint n_infos, i;
+
+    n_infos = _lazy_member_get_n_infos (container->info, kind);
+
+    for (i = 0; i < n_infos; i++) {
+        PyGILazyMember *member;
+        GIBaseInfo *info;
+        PyObject *name;
+        int ret;
+
+        info = _lazy_member_get_info (container->info, kind, i);
+        name = _base_info_get_py_name (info);
+        g_base_info_unref (info);
+        if (name == NULL)
+            return -1;
+        PYGLIB_PyUnicode_InternInPlace (&name);
+
+        member = PyObject_New (PyGILazyMember, &PyGILazyMember_Type);
+        if (member == NULL) {
+            Py_DECREF (name);
+            return -1;
+        }
+        Py_INCREF (container);
+        member->container = container;
+        member->name = name;
+        member->index = i;
+        member->kind = kind;
+
+        ret = PyObject_SetAttr (cls, name, (PyObject *) member);
+        Py_DECREF (member);
+        if (ret < 0)
+            return -1;
+    }
+
+    return 0;
+}
+
 /* Private */
 
 gchar *
@@ -2268,6 +2703,9 @@ _pygi_info_register_types (PyObject *m)
                          PyGIBaseInfo_Type);
     _PyGI_REGISTER_TYPE (m, PyGIFieldInfo_Type, FieldInfo,
                          PyGIBaseInfo_Type);
+    PyGIFieldInfo_Type.tp_dealloc = (destructor) _field_info_dealloc;
+    PyGIFieldInfo_Type.tp_descr_get = (descrgetfunc) _field_info_descr_get;
+    PyGIFieldInfo_Type.tp_descr_set = (descrsetfunc) _field_info_descr_set;
     _PyGI_REGISTER_TYPE (m, PyGIUnionInfo_Type, UnionInfo,
                          PyGIRegisteredTypeInfo_Type);
     _PyGI_REGISTER_TYPE (m, PyGIErrorDomainInfo_Type, ErrorDomainInfo,
@@ -2281,6 +2719,15 @@ _pygi_info_register_types (PyObject *m)
 
 #undef _PyGI_REGISTER_TYPE
 
+    Py_TYPE(&PyGILazyMember_Type) = &PyType_Type;
+    PyGILazyMember_Type.tp_flags = Py_TPFLAGS_DEFAULT;
+    PyGILazyMember_Type.tp_dealloc = (destructor) _lazy_member_dealloc;
+    PyGILazyMember_Type.tp_descr_get = (descrgetfunc) _lazy_member_descr_get;
+    if (PyType_Ready (&PyGILazyMember_Type))
+        return;
+    if (PyModule_AddObject (m, "LazyMember", (PyObject *) &PyGILazyMember_Type))
+        return;
+
 #define _PyGI_ENUM_BEGIN(name) \
         { \
             const char *__enum_name = #name; \
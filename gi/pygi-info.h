@@ -52,6 +52,7 @@ extern PyTypeObject PyGISignalInfo_Type;
 extern PyTypeObject PyGIPropertyInfo_Type;
 extern PyTypeObject PyGIArgInfo_Type;
 extern PyTypeObject PyGITypeInfo_Type;
+extern PyTypeObject PyGILazyMember_Type;
 
 #define PyGIBaseInfo_GET_GI_INFO(object) g_base_info_ref(((PyGIBaseInfo *)object)->info)
 
@@ -66,6 +67,15 @@ gsize _pygi_g_type_info_size (GITypeInfo *type_info);
 
 void _pygi_info_register_types (PyObject *m);
 
+typedef enum {
+    PYGI_LAZY_MEMBER_METHOD,
+    PYGI_LAZY_MEMBER_CONSTANT
+} PyGILazyMemberKind;
+
+int _pygi_info_setup_lazy_members (PyObject *cls,
+                                   PyObject *py_container,
+                                   PyGILazyMemberKind kind);
+
 gboolean _pygi_is_python_keyword (const gchar *name);
 
 G_END_DECLS
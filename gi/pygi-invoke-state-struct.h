@@ -7,10 +7,21 @@
 
 G_BEGIN_DECLS
 
+/* Callables with at most this many ffi arguments keep their per-call argument
+ * arrays inside the invoke state itself, which normally lives on the stack.
+ */
+#define PYGI_INVOKE_STATE_N_STACK_ARGS 8
+
 typedef struct _PyGIInvokeState
 {
-    PyObject *py_in_args;
+    /* Python arguments of the call. For calls from Python these are the
+     * positional arguments combined with keyword arguments and defaults
+     * (see _py_args_combine_and_check_length). The references are borrowed
+     * from the caller unless py_in_args_owned is set.
+     */
+    PyObject **py_in_args;
     gssize n_py_in_args;
+    gboolean py_in_args_owned;
 
     /* Number of arguments the ffi wrapped C function takes. Used as the exact
      * count for argument related arrays held in this struct.
@@ -52,6 +63,17 @@ typedef struct _PyGIInvokeState
     /* Function pointer to call with ffi. */
     gpointer function_ptr;
 
+    /* Backing storage for args, arg_values, arg_pointers and args_cleanup_data
+     * when n_args <= PYGI_INVOKE_STATE_N_STACK_ARGS. Larger callables use a
+     * single heap block instead. stack_py_in_args is used the same way when
+     * the Python arguments need to be combined into a new array.
+     */
+    GIArgument *stack_args[PYGI_INVOKE_STATE_N_STACK_ARGS];
+    GIArgument stack_arg_values[PYGI_INVOKE_STATE_N_STACK_ARGS];
+    GIArgument stack_arg_pointers[PYGI_INVOKE_STATE_N_STACK_ARGS];
+    gpointer stack_args_cleanup_data[PYGI_INVOKE_STATE_N_STACK_ARGS];
+    PyObject *stack_py_in_args[PYGI_INVOKE_STATE_N_STACK_ARGS];
+
 } PyGIInvokeState;
 
 G_END_DECLS
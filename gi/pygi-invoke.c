@@ -24,6 +24,7 @@
 #include "pygi-invoke.h"
 #include "pygi-marshal-cleanup.h"
 #include "pygi-error.h"
+#include "pygi-async.h"
 
 static gboolean
 _check_for_unexpected_kwargs (const gchar *function_name,
@@ -69,24 +70,31 @@ _check_for_unexpected_kwargs (const gchar *function_name,
 
 /**
  * _py_args_combine_and_check_length:
+ * @state: the invoke state to store the combined arguments in.
  * @cache: PyGICallableCache
- * @py_args: the tuple of positional arguments.
+ * @py_args: array of positional arguments.
+ * @n_py_args: number of items in @py_args.
  * @py_kwargs: the dict of keyword arguments to be merged with py_args.
  *
- * Returns: New value reference to the combined py_args and py_kwargs.
+ * Fills state->py_in_args with the combined py_args and py_kwargs. When
+ * there is nothing to combine @py_args is used directly, otherwise a new
+ * array holding references is created and state->py_in_args_owned is set.
+ *
+ * Returns: FALSE with an exception set on failure.
  */
-static PyObject *
-_py_args_combine_and_check_length (PyGICallableCache *cache,
-                                   PyObject    *py_args,
-                                   PyObject    *py_kwargs)
+static gboolean
+_py_args_combine_and_check_length (PyGIInvokeState   *state,
+                                   PyGICallableCache *cache,
+                                   PyObject         **py_args,
+                                   Py_ssize_t         n_py_args,
+                                   PyObject          *py_kwargs)
 {
-    PyObject *combined_py_args = NULL;
-    Py_ssize_t n_py_args, n_py_kwargs, i;
+    PyObject **combined_py_args = NULL;
+    Py_ssize_t n_py_kwargs, i;
     guint n_expected_args;
     GSList *l;
     const gchar *function_name = cache->name;
 
-    n_py_args = PyTuple_GET_SIZE (py_args);
     if (py_kwargs == NULL)
         n_py_kwargs = 0;
     else
@@ -95,8 +103,9 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
     /* Fast path, we already have the exact number of args and not kwargs. */
     n_expected_args = g_slist_length (cache->arg_name_list);
     if (n_py_kwargs == 0 && n_py_args == n_expected_args && cache->user_data_varargs_index < 0) {
-        Py_INCREF (py_args);
-        return py_args;
+        state->py_in_args = py_args;
+        state->n_py_in_args = n_py_args;
+        return TRUE;
     }
 
     if (cache->user_data_varargs_index < 0 && n_expected_args < n_py_args) {
@@ -107,25 +116,37 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
                       n_py_kwargs > 0 ? "non-keyword " : "",
                       n_expected_args == 1 ? "" : "s",
                       n_py_args);
-        return NULL;
+        return FALSE;
     }
 
     if (cache->user_data_varargs_index >= 0 && n_py_kwargs > 0 && n_expected_args < n_py_args) {
         PyErr_Format (PyExc_TypeError,
                       "%.200s() cannot use variable user data arguments with keyword arguments",
                       function_name);
-        return NULL;
+        return FALSE;
     }
 
     if (n_py_kwargs > 0 && !_check_for_unexpected_kwargs (function_name,
                                                           cache->arg_name_hash,
                                                           py_kwargs)) {
-        return NULL;
+        return FALSE;
     }
 
     /* will hold arguments from both py_args and py_kwargs
-     * when they are combined into a single tuple */
-    combined_py_args = PyTuple_New (n_expected_args);
+     * when they are combined into a single array */
+    if (n_expected_args <= PYGI_INVOKE_STATE_N_STACK_ARGS) {
+        combined_py_args = state->stack_py_in_args;
+        memset (combined_py_args, 0, n_expected_args * sizeof (PyObject *));
+    } else {
+        combined_py_args = g_new0 (PyObject *, n_expected_args);
+    }
+
+    /* Items are filled in with new references, any already set are released
+     * by _invoke_state_clear if combining fails part way through.
+     */
+    state->py_in_args = combined_py_args;
+    state->n_py_in_args = n_expected_args;
+    state->py_in_args_owned = TRUE;
 
     for (i = 0, l = cache->arg_name_list; i < n_expected_args && l; i++, l = l->next) {
         PyObject *py_arg_item = NULL;
@@ -148,17 +169,26 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
 
         /* use a bounded retrieval of the original input */
         if (i < n_py_args)
-            py_arg_item = PyTuple_GET_ITEM (py_args, i);
+            py_arg_item = py_args[i];
 
         if (kw_arg_item == NULL && py_arg_item != NULL) {
             if (is_varargs_user_data) {
                 /* For tail end user_data varargs, pull a slice off and we are done. */
-                PyObject *user_data = PyTuple_GetSlice (py_args, i, PY_SSIZE_T_MAX);
-                PyTuple_SET_ITEM (combined_py_args, i, user_data);
-                return combined_py_args;
+                PyObject *user_data = PyTuple_New (n_py_args - i);
+                Py_ssize_t j;
+
+                if (user_data == NULL)
+                    return FALSE;
+
+                for (j = i; j < n_py_args; j++) {
+                    Py_INCREF (py_args[j]);
+                    PyTuple_SET_ITEM (user_data, j - i, py_args[j]);
+                }
+                combined_py_args[i] = user_data;
+                return TRUE;
             } else {
                 Py_INCREF (py_arg_item);
-                PyTuple_SET_ITEM (combined_py_args, i, py_arg_item);
+                combined_py_args[i] = py_arg_item;
             }
         } else if (kw_arg_item != NULL && py_arg_item == NULL) {
             if (is_varargs_user_data) {
@@ -166,22 +196,22 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
                  * Wrap the value in a tuple to represent variable args for marshaling later on.
                  */
                 PyObject *user_data = Py_BuildValue("(O)", kw_arg_item, NULL);
-                PyTuple_SET_ITEM (combined_py_args, i, user_data);
+                combined_py_args[i] = user_data;
             } else {
                 Py_INCREF (kw_arg_item);
-                PyTuple_SET_ITEM (combined_py_args, i, kw_arg_item);
+                combined_py_args[i] = kw_arg_item;
             }
 
         } else if (kw_arg_item == NULL && py_arg_item == NULL) {
             if (is_varargs_user_data) {
                 /* For varargs user_data, pass an empty tuple when nothing is given. */
-                PyTuple_SET_ITEM (combined_py_args, i, PyTuple_New (0));
+                combined_py_args[i] = PyTuple_New (0);
             } else if (arg_cache_index >= 0 && _pygi_callable_cache_get_arg (cache, arg_cache_index)->has_default) {
                 /* If the argument supports a default, use a place holder in the
-                 * argument tuple, this will be checked later during marshaling.
+                 * argument array, this will be checked later during marshaling.
                  */
                 Py_INCREF (_PyGIDefaultArgPlaceholder);
-                PyTuple_SET_ITEM (combined_py_args, i, _PyGIDefaultArgPlaceholder);
+                combined_py_args[i] = _PyGIDefaultArgPlaceholder;
             } else {
                 PyErr_Format (PyExc_TypeError,
                               "%.200s() takes exactly %d %sargument%s (%zd given)",
@@ -191,8 +221,7 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
                               n_expected_args == 1 ? "" : "s",
                               n_py_args);
 
-                Py_DECREF (combined_py_args);
-                return NULL;
+                return FALSE;
             }
         } else if (kw_arg_item != NULL && py_arg_item != NULL) {
             PyErr_Format (PyExc_TypeError,
@@ -200,18 +229,65 @@ _py_args_combine_and_check_length (PyGICallableCache *cache,
                           function_name,
                           arg_name);
 
-            Py_DECREF (combined_py_args);
-            return NULL;
+            return FALSE;
         }
     }
 
-    return combined_py_args;
+    return TRUE;
+}
+
+/* Size of the heap block holding all of the argument arrays of a state
+ * with more than PYGI_INVOKE_STATE_N_STACK_ARGS arguments. The GIArgument
+ * arrays come first so they stay 8 byte aligned on 32 bit platforms.
+ */
+#define _invoke_state_args_block_size(n_args) \
+    ((n_args) * (2 * sizeof (GIArgument) + sizeof (GIArgument *) + sizeof (gpointer)))
+
+/* _invoke_state_alloc_args:
+ * @state: invoke state with n_args already set
+ *
+ * Points the argument arrays of @state at zeroed storage. Small callables use
+ * the storage embedded in the state so the call does not touch the heap,
+ * larger ones use a single slice for all four arrays.
+ *
+ * Returns: FALSE if the memory could not be allocated.
+ */
+static gboolean
+_invoke_state_alloc_args (PyGIInvokeState *state)
+{
+    gssize n_args = state->n_args;
+    guint8 *block;
+
+    if (n_args <= PYGI_INVOKE_STATE_N_STACK_ARGS) {
+        state->args = state->stack_args;
+        state->args_cleanup_data = state->stack_args_cleanup_data;
+        state->arg_values = state->stack_arg_values;
+        state->arg_pointers = state->stack_arg_pointers;
+
+        memset (state->args, 0, n_args * sizeof (GIArgument *));
+        memset (state->args_cleanup_data, 0, n_args * sizeof (gpointer));
+        memset (state->arg_values, 0, n_args * sizeof (GIArgument));
+        memset (state->arg_pointers, 0, n_args * sizeof (GIArgument));
+        return TRUE;
+    }
+
+    block = g_slice_alloc0 (_invoke_state_args_block_size (n_args));
+    if (block == NULL)
+        return FALSE;
+
+    state->arg_values = (GIArgument *) block;
+    state->arg_pointers = state->arg_values + n_args;
+    state->args = (GIArgument **) (state->arg_pointers + n_args);
+    state->args_cleanup_data = (gpointer *) (state->args + n_args);
+
+    return TRUE;
 }
 
 static gboolean
 _invoke_state_init_from_cache (PyGIInvokeState *state,
                                PyGIFunctionCache *function_cache,
-                               PyObject *py_args,
+                               PyObject **py_args,
+                               Py_ssize_t n_py_args,
                                PyObject *kwargs)
 {
     PyGICallableCache *cache = (PyGICallableCache *) function_cache;
@@ -228,35 +304,13 @@ _invoke_state_init_from_cache (PyGIInvokeState *state,
     if (state->function_ptr == NULL)
         state->function_ptr = function_cache->invoker.native_address;
 
-    state->py_in_args = _py_args_combine_and_check_length (cache,
-                                                           py_args,
-                                                           kwargs);
-
-    if (state->py_in_args == NULL) {
+    if (!_py_args_combine_and_check_length (state, cache,
+                                            py_args, n_py_args,
+                                            kwargs)) {
         return FALSE;
     }
-    state->n_py_in_args = PyTuple_Size (state->py_in_args);
 
-    state->args = g_slice_alloc0 (state->n_args * sizeof (GIArgument *));
-    if (state->args == NULL && state->n_args != 0) {
-        PyErr_NoMemory();
-        return FALSE;
-    }
-
-    state->args_cleanup_data = g_slice_alloc0 (state->n_args * sizeof (gpointer));
-    if (state->args_cleanup_data == NULL && state->n_args != 0) {
-        PyErr_NoMemory();
-        return FALSE;
-    }
-
-    state->arg_values = g_slice_alloc0 (state->n_args * sizeof(GIArgument));
-    if (state->arg_values == NULL && state->n_args != 0) {
-        PyErr_NoMemory ();
-        return FALSE;
-    }
-
-    state->arg_pointers = g_slice_alloc0 (state->n_args * sizeof(GIArgument));
-    if (state->arg_pointers == NULL && state->n_args != 0) {
+    if (!_invoke_state_alloc_args (state)) {
         PyErr_NoMemory ();
         return FALSE;
     }
@@ -276,12 +330,19 @@ _invoke_state_init_from_cache (PyGIInvokeState *state,
 static void
 _invoke_state_clear (PyGIInvokeState *state, PyGIFunctionCache *function_cache)
 {
-    g_slice_free1 (state->n_args * sizeof(GIArgument *), state->args);
-    g_slice_free1 (state->n_args * sizeof(gpointer), state->args_cleanup_data);
-    g_slice_free1 (state->n_args * sizeof(GIArgument), state->arg_values);
-    g_slice_free1 (state->n_args * sizeof(GIArgument), state->arg_pointers);
+    if (state->arg_values != NULL && state->arg_values != state->stack_arg_values)
+        g_slice_free1 (_invoke_state_args_block_size (state->n_args),
+                       state->arg_values);
 
-    Py_XDECREF (state->py_in_args);
+    if (state->py_in_args_owned) {
+        gssize i;
+
+        for (i = 0; i < state->n_py_in_args; i++)
+            Py_XDECREF (state->py_in_args[i]);
+
+        if (state->py_in_args != state->stack_py_in_args)
+            g_free (state->py_in_args);
+    }
 }
 
 static gboolean
@@ -402,9 +463,7 @@ _invoke_marshal_in_args (PyGIInvokeState *state, PyGIFunctionCache *function_cac
                     return FALSE;
                 }
 
-                py_arg =
-                    PyTuple_GET_ITEM (state->py_in_args,
-                                      arg_cache->py_arg_index);
+                py_arg = state->py_in_args[arg_cache->py_arg_index];
 
                 break;
             case PYGI_DIRECTION_BIDIRECTIONAL:
@@ -421,9 +480,7 @@ _invoke_marshal_in_args (PyGIInvokeState *state, PyGIFunctionCache *function_cac
                         return FALSE;
                     }
 
-                    py_arg =
-                        PyTuple_GET_ITEM (state->py_in_args,
-                                          arg_cache->py_arg_index);
+                    py_arg = state->py_in_args[arg_cache->py_arg_index];
                 }
                 /* Fall through */
 
@@ -606,31 +663,91 @@ _invoke_marshal_out_args (PyGIInvokeState *state, PyGIFunctionCache *function_ca
     return py_out;
 }
 
+/* _invoke_setup_async:
+ *
+ * Passes pygi_async_finish_cb() and a new gi.Async as callback and user
+ * data. The callback holds its own reference to the gi.Async until the
+ * operation completes, the other one is returned in @async.
+ */
+static gboolean
+_invoke_setup_async (PyGIInvokeState *state,
+                     PyGIFunctionCache *function_cache,
+                     PyObject **async)
+{
+    PyObject *py_cancellable = NULL;
+
+    if (function_cache->async_cancellable_index >= 0) {
+        GObject *cancellable =
+            state->arg_values[function_cache->async_cancellable_index].v_pointer;
+
+        if (cancellable != NULL) {
+            py_cancellable = pygobject_new (cancellable);
+            if (py_cancellable == NULL)
+                return FALSE;
+        }
+    }
+
+    *async = pygi_async_new (function_cache->async_finish,
+                             function_cache->async_finish_is_method,
+                             function_cache->async_finish_class,
+                             py_cancellable);
+    Py_XDECREF (py_cancellable);
+    if (*async == NULL)
+        return FALSE;
+
+    Py_INCREF (*async);
+    state->arg_values[function_cache->async_callback_index].v_pointer = pygi_async_finish_cb;
+    state->arg_values[function_cache->async_user_data_index].v_pointer = *async;
+
+    return TRUE;
+}
+
 PyObject *
 pygi_invoke_c_callable (PyGIFunctionCache *function_cache,
                         PyGIInvokeState *state,
-                        PyObject *py_args,
+                        PyObject **py_args,
+                        Py_ssize_t n_py_args,
                         PyObject *py_kwargs)
 {
     PyGICallableCache *cache = (PyGICallableCache *) function_cache;
     GIFFIReturnValue ffi_return_value = {0};
     PyObject *ret = NULL;
+    PyObject *async = NULL;
 
     if (!_invoke_state_init_from_cache (state, function_cache,
-                                        py_args, py_kwargs))
+                                        py_args, n_py_args, py_kwargs))
          goto err;
 
     if (!_invoke_marshal_in_args (state, function_cache))
          goto err;
 
-    Py_BEGIN_ALLOW_THREADS;
+    /* No callback given for an async function, finish it in C and return
+     * an awaitable instead of None. */
+    if (function_cache->async_finish != NULL &&
+            state->arg_values[function_cache->async_callback_index].v_pointer == NULL) {
+        if (!_invoke_setup_async (state, function_cache, &async)) {
+            pygi_marshal_cleanup_args_from_py_marshal_success (state, cache);
+            goto err;
+        }
+    }
 
+    if (function_cache->keep_gil) {
+        /* cheap accessors, releasing and taking back the GIL would cost
+         * more than the call itself */
         ffi_call (&function_cache->invoker.cif,
                   state->function_ptr,
                   (void *) &ffi_return_value,
                   (void **) state->args);
+    } else {
+        Py_BEGIN_ALLOW_THREADS;
+
+            ffi_call (&function_cache->invoker.cif,
+                      state->function_ptr,
+                      (void *) &ffi_return_value,
+                      (void **) state->args);
 
-    Py_END_ALLOW_THREADS;
+        Py_END_ALLOW_THREADS;
+    }
 
     /* If the callable throws, the address of state->error will be bound into
      * the state->args as the last value. When the callee sets an error using
@@ -658,23 +775,24 @@ pygi_invoke_c_callable (PyGIFunctionCache *function_cache,
     if (ret != NULL)
         pygi_marshal_cleanup_args_to_py_marshal_success (state, cache);
 
+    if (ret == Py_None && async != NULL) {
+        Py_DECREF (ret);
+        ret = async;
+        async = NULL;
+    }
+
 err:
+    Py_XDECREF (async);
     _invoke_state_clear (state, function_cache);
     return ret;
 }
 
-PyObject *
-pygi_callable_info_invoke (GIBaseInfo *info, PyObject *py_args,
-                           PyObject *kwargs, PyGICallableCache *cache,
-                           gpointer user_data)
-{
-    return pygi_function_cache_invoke ((PyGIFunctionCache *) cache,
-                                       py_args, kwargs);
-}
-
-PyObject *
-_wrap_g_callable_info_invoke (PyGIBaseInfo *self, PyObject *py_args,
-                              PyObject *kwargs)
+/* _callable_info_get_function_cache:
+ *
+ * Returns the function cache of @self, creating it on first use.
+ */
+static PyGIFunctionCache *
+_callable_info_get_function_cache (PyGIBaseInfo *self)
 {
     if (self->cache == NULL) {
         PyGIFunctionCache *function_cache;
@@ -701,9 +819,41 @@ _wrap_g_callable_info_invoke (PyGIBaseInfo *self, PyObject *py_args,
         }
 
         self->cache = (PyGICallableCache *)function_cache;
-        if (self->cache == NULL)
-            return NULL;
     }
 
-    return pygi_callable_info_invoke (self->info, py_args, kwargs, self->cache, NULL);
+    return (PyGIFunctionCache *) self->cache;
+}
+
+/* pygi_callable_info_invoke:
+ * @self: the callable info to invoke
+ * @py_args: array of positional arguments
+ * @n_py_args: number of items in @py_args
+ * @py_kwargs: (allow-none): dict of keyword arguments
+ *
+ * Invokes @self with arguments passed as a C array, which allows callers
+ * to avoid building an argument tuple (e.g. for bound methods).
+ */
+PyObject *
+pygi_callable_info_invoke (PyGIBaseInfo *self,
+                           PyObject    **py_args,
+                           Py_ssize_t    n_py_args,
+                           PyObject     *py_kwargs)
+{
+    PyGIFunctionCache *function_cache = _callable_info_get_function_cache (self);
+
+    if (function_cache == NULL)
+        return NULL;
+
+    return pygi_function_cache_invoke (function_cache,
+                                       py_args, n_py_args, py_kwargs);
+}
+
+PyObject *
+_wrap_g_callable_info_invoke (PyGIBaseInfo *self, PyObject *py_args,
+                              PyObject *kwargs)
+{
+    return pygi_callable_info_invoke (self,
+                                      PySequence_Fast_ITEMS (py_args),
+                                      PyTuple_GET_SIZE (py_args),
+                                      kwargs);
 }
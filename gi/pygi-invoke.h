@@ -31,10 +31,11 @@ G_BEGIN_DECLS
 
 PyObject *pygi_invoke_c_callable    (PyGIFunctionCache *function_cache,
                                      PyGIInvokeState *state,
-                                     PyObject *py_args, PyObject *py_kwargs);
-PyObject *pygi_callable_info_invoke (GIBaseInfo *info, PyObject *py_args,
-                                     PyObject *kwargs, PyGICallableCache *cache,
-                                     gpointer user_data);
+                                     PyObject **py_args, Py_ssize_t n_py_args,
+                                     PyObject *py_kwargs);
+PyObject *pygi_callable_info_invoke (PyGIBaseInfo *self,
+                                     PyObject **py_args, Py_ssize_t n_py_args,
+                                     PyObject *py_kwargs);
 PyObject *_wrap_g_callable_info_invoke (PyGIBaseInfo *self, PyObject *py_args,
                                         PyObject *kwargs);
 
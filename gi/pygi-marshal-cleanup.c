@@ -105,7 +105,7 @@ pygi_marshal_cleanup_args_from_py_marshal_success (PyGIInvokeState   *state,
          */
         if (cleanup_func && cleanup_data != NULL && arg_cache->py_arg_index >= 0 &&
                 arg_cache->direction & PYGI_DIRECTION_FROM_PYTHON) {
-            PyObject *py_arg = PyTuple_GET_ITEM (state->py_in_args, arg_cache->py_arg_index);
+            PyObject *py_arg = state->py_in_args[arg_cache->py_arg_index];
             cleanup_func (state, arg_cache, py_arg, cleanup_data, TRUE);
             state->args_cleanup_data[i] = NULL;
         }
@@ -171,7 +171,7 @@ pygi_marshal_cleanup_args_from_py_parameter_fail (PyGIInvokeState   *state,
         if (arg_cache->py_arg_index < 0) {
             continue;
         }
-        py_arg = PyTuple_GET_ITEM (state->py_in_args, arg_cache->py_arg_index);
+        py_arg = state->py_in_args[arg_cache->py_arg_index];
 
         if (cleanup_func && cleanup_data != NULL &&
                 arg_cache->direction == PYGI_DIRECTION_FROM_PYTHON) {
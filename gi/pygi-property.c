@@ -97,6 +97,110 @@ _pygi_lookup_property_from_g_type (GType g_type, const gchar *attr_name)
     return ret;
 }
 
+/* Introspection data of a property, attached to its GParamSpec so it is
+ * looked up only once instead of on every get and set.
+ */
+typedef struct {
+    GIPropertyInfo *property_info;
+    GITypeInfo *type_info;
+    GITypeTag type_tag;
+    GITransfer transfer;
+
+    /* Only set for GI_TYPE_TAG_INTERFACE */
+    GIInfoType interface_type;
+    GType interface_g_type;
+
+    PyObject *(*to_py) (GIArgument *arg, GITypeInfo *type_info);
+} PyGIPropertyCache;
+
+static GQuark pygi_property_cache_key = 0;
+
+static PyObject *
+_pygi_property_value_to_py (GIArgument *arg, GITypeInfo *type_info)
+{
+    return _pygi_argument_to_object (arg, type_info, GI_TRANSFER_NOTHING);
+}
+
+static PyObject *
+_pygi_property_array_value_to_py (GIArgument *arg, GITypeInfo *type_info)
+{
+    gboolean free_array = FALSE;
+    PyObject *py_value;
+
+    /* Arrays are special cased, see note in _pygi_argument_to_array. */
+    arg->v_pointer = _pygi_argument_to_array (arg, NULL, NULL, NULL,
+                                              type_info, &free_array);
+
+    py_value = _pygi_argument_to_object (arg, type_info, GI_TRANSFER_NOTHING);
+
+    if (free_array) {
+        g_array_free (arg->v_pointer, FALSE);
+    }
+
+    return py_value;
+}
+
+static void
+_pygi_property_cache_free (PyGIPropertyCache *cache)
+{
+    g_base_info_unref (cache->type_info);
+    g_base_info_unref (cache->property_info);
+    g_slice_free (PyGIPropertyCache, cache);
+}
+
+/* _pygi_property_cache_get:
+ * @pspec: property to get the introspection data for
+ *
+ * Returns: (transfer none): the cached introspection data of @pspec or NULL
+ *          if it is not introspectable.
+ */
+static PyGIPropertyCache *
+_pygi_property_cache_get (GParamSpec *pspec)
+{
+    PyGIPropertyCache *cache;
+    GIPropertyInfo *property_info;
+
+    if (G_UNLIKELY (pygi_property_cache_key == 0))
+        pygi_property_cache_key = g_quark_from_static_string ("PyGI::property-cache");
+
+    cache = g_param_spec_get_qdata (pspec, pygi_property_cache_key);
+    if (cache != NULL)
+        return cache;
+
+    /* The owner_type of the pspec gives us the exact type that introduced the
+     * property, even if it is a parent class of the instance in question.
+     * Failed lookups are not cached as the typelib providing the owner type
+     * might not be loaded yet. */
+    property_info = _pygi_lookup_property_from_g_type (pspec->owner_type,
+                                                       pspec->name);
+    if (property_info == NULL)
+        return NULL;
+
+    cache = g_slice_new0 (PyGIPropertyCache);
+    cache->property_info = property_info;
+    cache->type_info = g_property_info_get_type (property_info);
+    cache->type_tag = g_type_info_get_tag (cache->type_info);
+    cache->transfer = g_property_info_get_ownership_transfer (property_info);
+
+    if (cache->type_tag == GI_TYPE_TAG_INTERFACE) {
+        GIBaseInfo *info = g_type_info_get_interface (cache->type_info);
+
+        cache->interface_type = g_base_info_get_type (info);
+        cache->interface_g_type = g_registered_type_info_get_g_type (info);
+        g_base_info_unref (info);
+    }
+
+    if (cache->type_tag == GI_TYPE_TAG_ARRAY)
+        cache->to_py = _pygi_property_array_value_to_py;
+    else
+        cache->to_py = _pygi_property_value_to_py;
+
+    g_param_spec_set_qdata_full (pspec, pygi_property_cache_key, cache,
+                                 (GDestroyNotify) _pygi_property_cache_free);
+
+    return cache;
+}
+
 PyObject *
 pygi_call_do_get_property (PyObject *instance, GParamSpec *pspec)
 {
@@ -120,7 +224,7 @@ pygi_call_do_get_property (PyObject *instance, GParamSpec *pspec)
 PyObject *
 pygi_get_property_value (PyGObject *instance, GParamSpec *pspec)
 {
-    GIPropertyInfo *property_info = NULL;
+    PyGIPropertyCache *property_cache;
     GValue value = { 0, };
     PyObject *py_value = NULL;
     GType fundamental;
@@ -150,32 +254,12 @@ pygi_get_property_value (PyGObject *instance, GParamSpec *pspec)
         goto out;
     }
 
-    /* Attempt to marshal through GI.
-     * The owner_type of the pspec gives us the exact type that introduced the
-     * property, even if it is a parent class of the instance in question. */
-    property_info = _pygi_lookup_property_from_g_type (pspec->owner_type, pspec->name);
-    if (property_info) {
-        GITypeInfo *type_info = NULL;
-        gboolean free_array = FALSE;
-        GIArgument arg = { 0, };
-
-        type_info = g_property_info_get_type (property_info);
-        arg = _pygi_argument_from_g_value (&value, type_info);
-
-        /* Arrays are special cased, see note in _pygi_argument_to_array. */
-        if (g_type_info_get_tag (type_info) == GI_TYPE_TAG_ARRAY) {
-            arg.v_pointer = _pygi_argument_to_array (&arg, NULL, NULL, NULL,
-                                                     type_info, &free_array);
-        }
-
-        py_value = _pygi_argument_to_object (&arg, type_info, GI_TRANSFER_NOTHING);
-
-        if (free_array) {
-            g_array_free (arg.v_pointer, FALSE);
-        }
+    /* Attempt to marshal through GI. */
+    property_cache = _pygi_property_cache_get (pspec);
+    if (property_cache) {
+        GIArgument arg = _pygi_argument_from_g_value (&value, property_cache->type_info);
 
-        g_base_info_unref (type_info);
-        g_base_info_unref (property_info);
+        py_value = property_cache->to_py (&arg, property_cache->type_info);
     }
 
     /* Fallback to GValue marshalling. */
@@ -210,27 +294,22 @@ pygi_set_property_value (PyGObject *instance,
                          GParamSpec *pspec,
                          PyObject *py_value)
 {
-    GIPropertyInfo *property_info = NULL;
-    GITypeInfo *type_info = NULL;
-    GITypeTag type_tag;
-    GITransfer transfer;
+    PyGIPropertyCache *property_cache;
+    GITypeInfo *type_info;
     GValue value = { 0, };
     GIArgument arg = { 0, };
     gint ret_value = -1;
 
-    /* The owner_type of the pspec gives us the exact type that introduced the
-     * property, even if it is a parent class of the instance in question. */
-    property_info = _pygi_lookup_property_from_g_type (pspec->owner_type,
-                                                       pspec->name);
-    if (property_info == NULL)
+    property_cache = _pygi_property_cache_get (pspec);
+    if (property_cache == NULL)
         goto out;
 
     if (! (pspec->flags & G_PARAM_WRITABLE))
         goto out;
 
-    type_info = g_property_info_get_type (property_info);
-    transfer = g_property_info_get_ownership_transfer (property_info);
-    arg = _pygi_argument_from_object (py_value, type_info, transfer);
+    type_info = property_cache->type_info;
+    arg = _pygi_argument_from_object (py_value, type_info,
+                                      property_cache->transfer);
 
     if (PyErr_Occurred())
         goto out;
@@ -238,21 +317,12 @@ pygi_set_property_value (PyGObject *instance,
     g_value_init (&value, G_PARAM_SPEC_VALUE_TYPE (pspec));
 
     /* FIXME: Lots of types still unhandled */
-    type_tag = g_type_info_get_tag (type_info);
-    switch (type_tag) {
+    switch (property_cache->type_tag) {
         case GI_TYPE_TAG_INTERFACE:
         {
-            GIBaseInfo *info;
-            GIInfoType info_type;
-            GType type;
-
-            info = g_type_info_get_interface (type_info);
-            type = g_registered_type_info_get_g_type (info);
-            info_type = g_base_info_get_type (info);
+            GType type = property_cache->interface_g_type;
 
-            g_base_info_unref (info);
-
-            switch (info_type) {
+            switch (property_cache->interface_type) {
                 case GI_INFO_TYPE_ENUM:
                     g_value_set_enum (&value, arg.v_int);
                     break;
@@ -373,11 +443,6 @@ pygi_set_property_value (PyGObject *instance,
     ret_value = 0;
 
 out:
-    if (property_info != NULL)
-        g_base_info_unref (property_info);
-    if (type_info != NULL)
-        g_base_info_unref (type_info);
-
     return ret_value;
 }
 
@@ -27,6 +27,48 @@ PyObject *PyGIRepositoryError;
 
 PYGLIB_DEFINE_TYPE("gi.Repository", PyGIRepository_Type, PyGIRepository);
 
+/* Namespace name to index of name to info position (plus one), built by
+ * Repository.build_index. Info names point into the typelibs, which are
+ * never unloaded. */
+static GHashTable *namespace_indices = NULL;
+
+static GHashTable *
+_pygi_repository_build_index (GIRepository *repository,
+                              const char   *namespace_)
+{
+    GHashTable *index;
+    gint n_infos, i;
+
+    if (namespace_indices == NULL)
+        namespace_indices = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                                   g_free,
+                                                   (GDestroyNotify) g_hash_table_unref);
+
+    index = g_hash_table_lookup (namespace_indices, namespace_);
+    if (index != NULL)
+        return index;
+
+    n_infos = g_irepository_get_n_infos (repository, namespace_);
+    if (n_infos < 0) {
+        PyErr_Format (PyExc_RuntimeError, "Namespace '%s' not loaded", namespace_);
+        return NULL;
+    }
+
+    index = g_hash_table_new (g_str_hash, g_str_equal);
+    for (i = 0; i < n_infos; i++) {
+        GIBaseInfo *info;
+
+        info = g_irepository_get_info (repository, namespace_, i);
+        g_hash_table_insert (index, (gpointer) g_base_info_get_name (info),
+                             GINT_TO_POINTER (i + 1));
+        g_base_info_unref (info);
+    }
+
+    g_hash_table_insert (namespace_indices, g_strdup (namespace_), index);
+    return index;
+}
+
+
 static PyObject *
 _wrap_g_irepository_enumerate_versions (PyGIRepository *self,
                                         PyObject       *args,
@@ -117,6 +159,7 @@ _wrap_g_irepository_find_by_name (PyGIRepository *self,
     const char *namespace_;
     const char *name;
     GIBaseInfo *info;
+    GHashTable *index;
     PyObject *py_info;
     size_t len;
     char *trimmed_name = NULL;
@@ -138,7 +181,16 @@ _wrap_g_irepository_find_by_name (PyGIRepository *self,
         }
     }
 
-    info = g_irepository_find_by_name (self->repository, namespace_, name);
+    if (namespace_indices != NULL &&
+            (index = g_hash_table_lookup (namespace_indices, namespace_)) != NULL) {
+        gint position = GPOINTER_TO_INT (g_hash_table_lookup (index, name));
+
+        info = position > 0 ?
+            g_irepository_get_info (self->repository, namespace_, position - 1) :
+            NULL;
+    } else {
+        info = g_irepository_find_by_name (self->repository, namespace_, name);
+    }
     g_free (trimmed_name);
 
     if (info == NULL) {
@@ -152,6 +204,25 @@ _wrap_g_irepository_find_by_name (PyGIRepository *self,
     return py_info;
 }
 
+static PyObject *
+_wrap_g_irepository_build_index (PyGIRepository *self,
+                                 PyObject       *args,
+                                 PyObject       *kwargs)
+{
+    static char *kwlist[] = { "namespace", NULL };
+    const char *namespace_;
+
+    if (!PyArg_ParseTupleAndKeywords (args, kwargs, "s:Repository.build_index",
+                                      kwlist, &namespace_)) {
+        return NULL;
+    }
+
+    if (_pygi_repository_build_index (self->repository, namespace_) == NULL)
+        return NULL;
+
+    Py_RETURN_NONE;
+}
+
 static PyObject *
 _wrap_g_irepository_get_infos (PyGIRepository *self,
                                PyObject       *args,
@@ -273,6 +344,7 @@ static PyMethodDef _PyGIRepository_methods[] = {
     { "require", (PyCFunction) _wrap_g_irepository_require, METH_VARARGS | METH_KEYWORDS },
     { "get_infos", (PyCFunction) _wrap_g_irepository_get_infos, METH_VARARGS | METH_KEYWORDS },
     { "find_by_name", (PyCFunction) _wrap_g_irepository_find_by_name, METH_VARARGS | METH_KEYWORDS },
+    { "build_index", (PyCFunction) _wrap_g_irepository_build_index, METH_VARARGS | METH_KEYWORDS },
     { "get_typelib_path", (PyCFunction) _wrap_g_irepository_get_typelib_path, METH_VARARGS | METH_KEYWORDS },
     { "get_version", (PyCFunction) _wrap_g_irepository_get_version, METH_VARARGS | METH_KEYWORDS },
     { "get_loaded_namespaces", (PyCFunction) _wrap_g_irepository_get_loaded_namespaces, METH_NOARGS },
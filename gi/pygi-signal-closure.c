@@ -18,6 +18,7 @@
 
 #include "pygi-private.h"
 #include "pygi-value.h"
+#include "pygi-basictype.h"
 
 static GISignalInfo *
 _pygi_lookup_signal_from_g_type (GType g_type,
@@ -43,6 +44,231 @@ _pygi_lookup_signal_from_g_type (GType g_type,
     return signal_info;
 }
 
+typedef struct _PyGISignalArgCache PyGISignalArgCache;
+
+typedef PyObject *(*PyGISignalArgToPyFunc) (PyGISignalCache    *cache,
+                                            PyGISignalArgCache *arg_cache,
+                                            const GValue       *param_values,
+                                            guint               index,
+                                            GSList            **pass_by_ref_structs);
+
+struct _PyGISignalArgCache
+{
+    GITypeInfo *type_info;
+    GITypeTag type_tag;
+    PyGISignalArgToPyFunc to_py;
+};
+
+/* Introspection data of a signal resolved once at connect time, so
+ * emissions don't have to walk the GISignalInfo for each argument.
+ */
+struct _PyGISignalCache
+{
+    GISignalInfo *signal_info;
+    gint n_args;
+    PyGISignalArgCache *args;
+};
+
+static PyObject *
+_pygi_signal_arg_basic_to_py (PyGISignalCache    *cache,
+                              PyGISignalArgCache *arg_cache,
+                              const GValue       *param_values,
+                              guint               index,
+                              GSList            **pass_by_ref_structs)
+{
+    GIArgument arg = _pygi_argument_from_g_value (&param_values[index],
+                                                  arg_cache->type_info);
+
+    return _pygi_marshal_to_py_basic_type (&arg, arg_cache->type_tag,
+                                           GI_TRANSFER_NOTHING);
+}
+
+static PyObject *
+_pygi_signal_arg_array_to_py (PyGISignalCache    *cache,
+                              PyGISignalArgCache *arg_cache,
+                              const GValue       *param_values,
+                              guint               index,
+                              GSList            **pass_by_ref_structs)
+{
+    GIArgument arg = _pygi_argument_from_g_value (&param_values[index],
+                                                  arg_cache->type_info);
+    gboolean free_array = FALSE;
+    PyObject *item;
+
+    /* Skip the self argument of param_values */
+    arg.v_pointer = _pygi_argument_to_array (&arg,
+                                             _pygi_argument_array_length_marshal,
+                                             (void *)(param_values + 1),
+                                             cache->signal_info,
+                                             arg_cache->type_info,
+                                             &free_array);
+
+    item = _pygi_argument_to_object (&arg, arg_cache->type_info, GI_TRANSFER_NOTHING);
+
+    if (free_array) {
+        g_array_free (arg.v_pointer, FALSE);
+    }
+
+    return item;
+}
+
+/* Hack to ensure struct arguments are passed-by-reference allowing
+ * callback implementors to modify the struct values. This is needed
+ * for keeping backwards compatibility and should be removed in future
+ * versions which support signal output arguments as return values.
+ * See: https://bugzilla.gnome.org/show_bug.cgi?id=735486
+ */
+static PyObject *
+_pygi_signal_arg_struct_by_ref_to_py (PyGISignalCache    *cache,
+                                      PyGISignalArgCache *arg_cache,
+                                      const GValue       *param_values,
+                                      guint               index,
+                                      GSList            **pass_by_ref_structs)
+{
+    GIArgument arg = _pygi_argument_from_g_value (&param_values[index],
+                                                  arg_cache->type_info);
+    PyObject *item;
+
+    /* transfer everything will ensure the struct is not copied when wrapped. */
+    item = _pygi_argument_to_object (&arg, arg_cache->type_info, GI_TRANSFER_EVERYTHING);
+    if (item && PyObject_IsInstance (item, (PyObject *) &PyGIBoxed_Type)) {
+        ((PyGBoxed *)item)->free_on_dealloc = FALSE;
+        *pass_by_ref_structs = g_slist_prepend (*pass_by_ref_structs, item);
+    }
+
+    return item;
+}
+
+static PyObject *
+_pygi_signal_arg_to_py (PyGISignalCache    *cache,
+                        PyGISignalArgCache *arg_cache,
+                        const GValue       *param_values,
+                        guint               index,
+                        GSList            **pass_by_ref_structs)
+{
+    GIArgument arg = _pygi_argument_from_g_value (&param_values[index],
+                                                  arg_cache->type_info);
+
+    return _pygi_argument_to_object (&arg, arg_cache->type_info, GI_TRANSFER_NOTHING);
+}
+
+/* Note the logic here must match the logic path taken in _pygi_argument_to_object. */
+static gboolean
+_pygi_signal_arg_is_struct_by_ref (GITypeInfo *type_info)
+{
+    GIBaseInfo *info = g_type_info_get_interface (type_info);
+    GIInfoType info_type = g_base_info_get_type (info);
+    gboolean pass_struct_by_ref = FALSE;
+
+    if (info_type == GI_INFO_TYPE_STRUCT ||
+            info_type == GI_INFO_TYPE_BOXED ||
+            info_type == GI_INFO_TYPE_UNION) {
+
+        GType gtype = g_registered_type_info_get_g_type ((GIRegisteredTypeInfo *) info);
+        gboolean is_foreign = (info_type == GI_INFO_TYPE_STRUCT) &&
+                              (g_struct_info_is_foreign ((GIStructInfo *) info));
+
+        if (!is_foreign && !g_type_is_a (gtype, G_TYPE_VALUE) &&
+                g_type_is_a (gtype, G_TYPE_BOXED)) {
+            pass_struct_by_ref = TRUE;
+        }
+    }
+
+    g_base_info_unref (info);
+    return pass_struct_by_ref;
+}
+
+static PyGISignalCache *
+pygi_signal_cache_new (GISignalInfo *signal_info)
+{
+    PyGISignalCache *cache;
+    gint i;
+
+    cache = g_slice_new0 (PyGISignalCache);
+    cache->signal_info = signal_info;
+    cache->n_args = g_callable_info_get_n_args (signal_info);
+    cache->args = g_new0 (PyGISignalArgCache, cache->n_args);
+
+    for (i = 0; i < cache->n_args; i++) {
+        PyGISignalArgCache *arg_cache = &cache->args[i];
+        GIArgInfo *arg_info = g_callable_info_get_arg (signal_info, i);
+
+        arg_cache->type_info = g_arg_info_get_type (arg_info);
+        arg_cache->type_tag = g_type_info_get_tag (arg_cache->type_info);
+        g_base_info_unref (arg_info);
+
+        switch (arg_cache->type_tag) {
+            case GI_TYPE_TAG_BOOLEAN:
+            case GI_TYPE_TAG_INT8:
+            case GI_TYPE_TAG_UINT8:
+            case GI_TYPE_TAG_INT16:
+            case GI_TYPE_TAG_UINT16:
+            case GI_TYPE_TAG_INT32:
+            case GI_TYPE_TAG_UINT32:
+            case GI_TYPE_TAG_INT64:
+            case GI_TYPE_TAG_UINT64:
+            case GI_TYPE_TAG_FLOAT:
+            case GI_TYPE_TAG_DOUBLE:
+            case GI_TYPE_TAG_GTYPE:
+            case GI_TYPE_TAG_UNICHAR:
+            case GI_TYPE_TAG_UTF8:
+            case GI_TYPE_TAG_FILENAME:
+                arg_cache->to_py = _pygi_signal_arg_basic_to_py;
+                break;
+            case GI_TYPE_TAG_ARRAY:
+                arg_cache->to_py = _pygi_signal_arg_array_to_py;
+                break;
+            case GI_TYPE_TAG_INTERFACE:
+                if (_pygi_signal_arg_is_struct_by_ref (arg_cache->type_info))
+                    arg_cache->to_py = _pygi_signal_arg_struct_by_ref_to_py;
+                else
+                    arg_cache->to_py = _pygi_signal_arg_to_py;
+                break;
+            default:
+                arg_cache->to_py = _pygi_signal_arg_to_py;
+                break;
+        }
+    }
+
+    return cache;
+}
+
+/* Signal caches by signal id. Signal ids are never reused, so the caches
+ * are shared by all closures connected to a signal and are never freed. */
+static GHashTable *signal_caches = NULL;
+
+/* pygi_signal_cache_get:
+ *
+ * Returns: (transfer none): the cache of the signal or NULL if the signal
+ *          is not introspectable.
+ */
+static PyGISignalCache *
+pygi_signal_cache_get (GType g_type,
+                       guint signal_id,
+                       const gchar *signal_name)
+{
+    PyGISignalCache *cache;
+    GISignalInfo *signal_info;
+
+    if (signal_caches == NULL)
+        signal_caches = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+    cache = g_hash_table_lookup (signal_caches, GUINT_TO_POINTER (signal_id));
+    if (cache != NULL)
+        return cache;
+
+    /* Failed lookups are not cached as the typelib providing the type
+     * might not be loaded yet. */
+    signal_info = _pygi_lookup_signal_from_g_type (g_type, signal_name);
+    if (signal_info == NULL)
+        return NULL;
+
+    cache = pygi_signal_cache_new (signal_info);
+    g_hash_table_insert (signal_caches, GUINT_TO_POINTER (signal_id), cache);
+
+    return cache;
+}
+
 static void
 pygi_signal_closure_invalidate(gpointer data,
                                GClosure *closure)
@@ -60,8 +286,7 @@ pygi_signal_closure_invalidate(gpointer data,
     pc->extra_args = NULL;
     pc->swap_data = NULL;
 
-    g_base_info_unref (((PyGISignalClosure *) pc)->signal_info);
-    ((PyGISignalClosure *) pc)->signal_info = NULL;
+    ((PyGISignalClosure *) pc)->cache = NULL;
 }
 
 static void
@@ -75,122 +300,56 @@ pygi_signal_closure_marshal(GClosure *closure,
     PyGILState_STATE state;
     PyGClosure *pc = (PyGClosure *)closure;
     PyObject *params, *ret = NULL;
+    Py_ssize_t n_extra_args;
     guint i;
-    GISignalInfo *signal_info;
-    gint n_sig_info_args;
-    gint sig_info_highest_arg;
+    PyGISignalCache *cache;
     GSList *list_item = NULL;
     GSList *pass_by_ref_structs = NULL;
 
     state = PyGILState_Ensure();
 
-    signal_info = ((PyGISignalClosure *)closure)->signal_info;
-    n_sig_info_args = g_callable_info_get_n_args(signal_info);
+    cache = ((PyGISignalClosure *)closure)->cache;
     /* the first argument to a signal callback is instance,
        but instance is not counted in the introspection data */
-    sig_info_highest_arg = n_sig_info_args + 1;
-    g_assert_cmpint(sig_info_highest_arg, ==, n_param_values);
+    g_assert_cmpint(cache->n_args + 1, ==, n_param_values);
 
-    /* construct Python tuple for the parameter values */
-    params = PyTuple_New(n_param_values);
+    /* construct Python tuple for the parameter values, leaving room for
+     * the extra arguments so they don't need to be concatenated */
+    n_extra_args = pc->extra_args ? PyTuple_GET_SIZE(pc->extra_args) : 0;
+    params = PyTuple_New(n_param_values + n_extra_args);
     for (i = 0; i < n_param_values; i++) {
+        PyObject *item;
+
         /* swap in a different initial data for connect_object() */
         if (i == 0 && G_CCLOSURE_SWAP_DATA(closure)) {
             g_return_if_fail(pc->swap_data != NULL);
             Py_INCREF(pc->swap_data);
             PyTuple_SetItem(params, 0, pc->swap_data);
+            continue;
 
         } else if (i == 0) {
-            PyObject *item = pyg_value_as_pyobject(&param_values[i], FALSE);
-
-            if (!item) {
-                goto out;
-            }
-            PyTuple_SetItem(params, i, item);
-
-        } else if (i < sig_info_highest_arg) {
-            GIArgInfo arg_info;
-            GITypeInfo type_info;
-            GITypeTag type_tag;
-            GIArgument arg = { 0, };
-            PyObject *item = NULL;
-            gboolean free_array = FALSE;
-            gboolean pass_struct_by_ref = FALSE;
-
-            g_callable_info_load_arg(signal_info, i - 1, &arg_info);
-            g_arg_info_load_type(&arg_info, &type_info);
-
-            arg = _pygi_argument_from_g_value(&param_values[i], &type_info);
-
-            type_tag = g_type_info_get_tag (&type_info);
-            if (type_tag == GI_TYPE_TAG_ARRAY) {
-                /* Skip the self argument of param_values */
-                arg.v_pointer = _pygi_argument_to_array (&arg,
-                                                         _pygi_argument_array_length_marshal,
-                                                         (void *)(param_values + 1),
-                                                         signal_info,
-                                                         &type_info,
-                                                         &free_array);
-            }
-
-            /* Hack to ensure struct arguments are passed-by-reference allowing
-             * callback implementors to modify the struct values. This is needed
-             * for keeping backwards compatibility and should be removed in future
-             * versions which support signal output arguments as return values.
-             * See: https://bugzilla.gnome.org/show_bug.cgi?id=735486
-             *
-             * Note the logic here must match the logic path taken in _pygi_argument_to_object.
-             */
-            if (type_tag == GI_TYPE_TAG_INTERFACE) {
-                GIBaseInfo *info = g_type_info_get_interface (&type_info);
-                GIInfoType info_type = g_base_info_get_type (info);
-
-                if (info_type == GI_INFO_TYPE_STRUCT ||
-                        info_type == GI_INFO_TYPE_BOXED ||
-                        info_type == GI_INFO_TYPE_UNION) {
-
-                    GType gtype = g_registered_type_info_get_g_type ((GIRegisteredTypeInfo *) info);
-                    gboolean is_foreign = (info_type == GI_INFO_TYPE_STRUCT) &&
-                                          (g_struct_info_is_foreign ((GIStructInfo *) info));
-
-                    if (!is_foreign && !g_type_is_a (gtype, G_TYPE_VALUE) &&
-                            g_type_is_a (gtype, G_TYPE_BOXED)) {
-                        pass_struct_by_ref = TRUE;
-                    }
-                }
-
-                g_base_info_unref (info);
-            }
-
-            if (pass_struct_by_ref) {
-                /* transfer everything will ensure the struct is not copied when wrapped. */
-                item = _pygi_argument_to_object (&arg, &type_info, GI_TRANSFER_EVERYTHING);
-                if (item && PyObject_IsInstance (item, (PyObject *) &PyGIBoxed_Type)) {
-                    ((PyGBoxed *)item)->free_on_dealloc = FALSE;
-                    pass_by_ref_structs = g_slist_prepend (pass_by_ref_structs, item);
-                }
-
-            } else {
-                item = _pygi_argument_to_object (&arg, &type_info, GI_TRANSFER_NOTHING);
-            }
-
-            if (free_array) {
-                g_array_free (arg.v_pointer, FALSE);
-            }
-
-            if (item == NULL) {
-                goto out;
-            }
-            PyTuple_SetItem(params, i, item);
+            item = pyg_value_as_pyobject(&param_values[i], FALSE);
+
+        } else {
+            PyGISignalArgCache *arg_cache = &cache->args[i - 1];
+
+            item = arg_cache->to_py (cache, arg_cache, param_values, i,
+                                     &pass_by_ref_structs);
+        }
+
+        if (item == NULL) {
+            goto out;
         }
+        PyTuple_SetItem(params, i, item);
     }
     /* params passed to function may have extra arguments */
-    if (pc->extra_args) {
-        PyObject *tuple = params;
-        params = PySequence_Concat(tuple, pc->extra_args);
-        Py_DECREF(tuple);
+    for (i = 0; i < n_extra_args; i++) {
+        PyObject *item = PyTuple_GET_ITEM(pc->extra_args, i);
+
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(params, n_param_values + i, item);
     }
-    ret = PyObject_CallObject(pc->callback, params);
+    ret = PyObject_Call(pc->callback, params, NULL);
     if (ret == NULL) {
         if (pc->exception_handler)
             pc->exception_handler(return_value, n_param_values, param_values);
@@ -235,6 +394,7 @@ pygi_signal_closure_marshal(GClosure *closure,
 GClosure *
 pygi_signal_closure_new (PyGObject *instance,
                          GType g_type,
+                         guint signal_id,
                          const gchar *signal_name,
                          PyObject *callback,
                          PyObject *extra_args,
@@ -242,12 +402,12 @@ pygi_signal_closure_new (PyGObject *instance,
 {
     GClosure *closure = NULL;
     PyGISignalClosure *pygi_closure = NULL;
-    GISignalInfo *signal_info = NULL;
+    PyGISignalCache *cache;
 
     g_return_val_if_fail(callback != NULL, NULL);
 
-    signal_info = _pygi_lookup_signal_from_g_type (g_type, signal_name);
-    if (signal_info == NULL)
+    cache = pygi_signal_cache_get (g_type, signal_id, signal_name);
+    if (cache == NULL)
         return NULL;
 
     closure = g_closure_new_simple(sizeof(PyGISignalClosure), NULL);
@@ -256,7 +416,7 @@ pygi_signal_closure_new (PyGObject *instance,
 
     pygi_closure = (PyGISignalClosure *)closure;
 
-    pygi_closure->signal_info = signal_info;
+    pygi_closure->cache = cache;
     Py_INCREF(callback);
     pygi_closure->pyg_closure.callback = callback;
 
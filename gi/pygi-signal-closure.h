@@ -29,15 +29,18 @@
 G_BEGIN_DECLS
 
 /* Private */
+typedef struct _PyGISignalCache PyGISignalCache;
+
 typedef struct _PyGISignalClosure
 {
     PyGClosure pyg_closure;
-    GISignalInfo *signal_info;
+    PyGISignalCache *cache;
 } PyGISignalClosure;
 
 GClosure *
 pygi_signal_closure_new (PyGObject *instance,
                          GType g_type,
+                         guint signal_id,
                          const gchar *sig_name,
                          PyObject *callback,
                          PyObject *extra_args,
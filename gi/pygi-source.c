@@ -34,8 +34,100 @@ typedef struct
 {
     GSource source;
     PyObject *obj;
+
+    /* Set up by pyg_source_setup_methods(), the functions implementing the
+     * methods of obj's class or NULL to look them up by name on each call.
+     * prepare and check are not called at all while they are the defaults
+     * of GLib.Source, so idle sources do not need the GIL for them. */
+    gboolean methods_set_up;
+    gboolean default_prepare;
+    gboolean default_check;
+    PyObject *prepare_func;
+    PyObject *check_func;
+    PyObject *dispatch_func;
 } PyGRealSource;
 
+/* Returns a new reference to the function implementing @name for @obj, or
+ * NULL without an exception set if it has to be called by name. */
+static PyObject *
+pyg_source_get_method_func (PyObject *obj, const char *name)
+{
+    PyObject *method, *func = NULL;
+
+    method = PyObject_GetAttrString (obj, name);
+    if (method == NULL) {
+        PyErr_Clear ();
+        return NULL;
+    }
+
+    if (PyMethod_Check (method) && PyMethod_GET_SELF (method) == obj) {
+        func = PyMethod_GET_FUNCTION (method);
+        Py_INCREF (func);
+    }
+
+    Py_DECREF (method);
+    return func;
+}
+
+/* Returns a new reference to the function implementing @name in the
+ * GLib.Source override, or NULL. */
+static PyObject *
+pyg_source_get_default_func (const char *name)
+{
+    PyObject *py_type, *attr, *func = NULL;
+
+    py_type = _pygi_type_import_by_name ("GLib", "Source");
+    if (py_type == NULL) {
+        PyErr_Clear ();
+        return NULL;
+    }
+
+    attr = PyObject_GetAttrString (py_type, name);
+    Py_DECREF (py_type);
+    if (attr == NULL) {
+        PyErr_Clear ();
+        return NULL;
+    }
+
+#if PY_VERSION_HEX < 0x03000000
+    /* unbound method */
+    if (PyMethod_Check (attr)) {
+        func = PyMethod_GET_FUNCTION (attr);
+        Py_INCREF (func);
+    }
+    Py_DECREF (attr);
+#else
+    func = attr;
+#endif
+    return func;
+}
+
+/* Called with the GIL held. */
+static void
+pyg_source_setup_methods_real (PyGRealSource *pysource)
+{
+    static PyObject *default_prepare = NULL;
+    static PyObject *default_check = NULL;
+
+    if (pysource->methods_set_up)
+        return;
+
+    if (default_prepare == NULL)
+        default_prepare = pyg_source_get_default_func ("prepare");
+    if (default_check == NULL)
+        default_check = pyg_source_get_default_func ("check");
+
+    pysource->prepare_func = pyg_source_get_method_func (pysource->obj, "prepare");
+    pysource->check_func = pyg_source_get_method_func (pysource->obj, "check");
+    pysource->dispatch_func = pyg_source_get_method_func (pysource->obj, "dispatch");
+
+    pysource->default_prepare = pysource->prepare_func != NULL &&
+                                pysource->prepare_func == default_prepare;
+    pysource->default_check = pysource->check_func != NULL &&
+                              pysource->check_func == default_check;
+    pysource->methods_set_up = TRUE;
+}
+
 static gboolean
 pyg_source_prepare(GSource *source, gint *timeout)
 {
@@ -45,9 +137,17 @@ pyg_source_prepare(GSource *source, gint *timeout)
     gboolean got_err = TRUE;
     PyGILState_STATE state;
 
+    /* GLib.Source.prepare() returns False, leave *timeout at -1 */
+    if (pysource->methods_set_up && pysource->default_prepare)
+        return FALSE;
+
     state = pyglib_gil_state_ensure();
 
-    t = PyObject_CallMethod(pysource->obj, "prepare", NULL);
+    pyg_source_setup_methods_real (pysource);
+    if (pysource->prepare_func != NULL)
+        t = PyObject_CallFunctionObjArgs (pysource->prepare_func, pysource->obj, NULL);
+    else
+        t = PyObject_CallMethod(pysource->obj, "prepare", NULL);
 
     if (t == NULL) {
 	goto bail;
@@ -94,9 +194,16 @@ pyg_source_check(GSource *source)
     gboolean ret;
     PyGILState_STATE state;
 
+    if (pysource->methods_set_up && pysource->default_check)
+        return FALSE;
+
     state = pyglib_gil_state_ensure();
 
-    t = PyObject_CallMethod(pysource->obj, "check", NULL);
+    pyg_source_setup_methods_real (pysource);
+    if (pysource->check_func != NULL)
+        t = PyObject_CallFunctionObjArgs (pysource->check_func, pysource->obj, NULL);
+    else
+        t = PyObject_CallMethod(pysource->obj, "check", NULL);
 
     if (t == NULL) {
 	PyErr_Print();
@@ -131,7 +238,12 @@ pyg_source_dispatch(GSource *source, GSourceFunc callback, gpointer user_data)
 	args = Py_None;
     }
 
-    t = PyObject_CallMethod(pysource->obj, "dispatch", "OO", func, args);
+    pyg_source_setup_methods_real (pysource);
+    if (pysource->dispatch_func != NULL)
+        t = PyObject_CallFunctionObjArgs (pysource->dispatch_func, pysource->obj,
+                                          func, args, NULL);
+    else
+        t = PyObject_CallMethod(pysource->obj, "dispatch", "OO", func, args);
 
     if (t == NULL) {
 	PyErr_Print();
@@ -155,6 +267,10 @@ pyg_source_finalize(GSource *source)
 
     state = pyglib_gil_state_ensure();
 
+    Py_CLEAR (pysource->prepare_func);
+    Py_CLEAR (pysource->check_func);
+    Py_CLEAR (pysource->dispatch_func);
+
     func = PyObject_GetAttrString(pysource->obj, "finalize");
     if (func) {
 	t = PyObject_CallObject(func, NULL);
@@ -224,6 +340,37 @@ pyg_source_set_callback(PyGObject *self_module, PyObject *args)
     return Py_None;
 }
 
+/**
+ * pyg_source_setup_methods:
+ * @self: module object
+ * @args: the GLib.Source to set up
+ *
+ * Looks up the prepare(), check() and dispatch() implementations of a
+ * source created with pyg_source_new(), called when the source gets
+ * attached. Sources which do not override prepare() or check() then run
+ * those phases without taking the GIL.
+ */
+PyObject *
+pyg_source_setup_methods (PyObject *self, PyObject *args)
+{
+    PyObject *py_source;
+    GSource *source;
+
+    if (!PyArg_ParseTuple (args, "O:source_setup_methods", &py_source))
+        return NULL;
+
+    if (!pyg_boxed_check (py_source, G_TYPE_SOURCE)) {
+        PyErr_SetString (PyExc_TypeError, "argument is not a GLib.Source");
+        return NULL;
+    }
+
+    source = pyg_boxed_get (py_source, GSource);
+    if (source->source_funcs == &pyg_source_funcs)
+        pyg_source_setup_methods_real ((PyGRealSource *) source);
+
+    Py_RETURN_NONE;
+}
+
 /**
  * pyg_source_new:
  *
@@ -26,6 +26,7 @@
 
 PyObject *pyg_source_new (void);
 PyObject *pyg_source_set_callback (PyGObject *self, PyObject *args);
+PyObject *pyg_source_setup_methods (PyObject *self, PyObject *args);
 
 #endif /* __PYGI_SOURCE_H__ */
 
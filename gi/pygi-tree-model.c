@@ -0,0 +1,742 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "pygi-tree-model.h"
+#include "pygi-private.h"
+#include "pygi-value.h"
+
+/*
+ * Native helpers for the Gtk.ListStore and Gtk.TreeStore overrides.
+ *
+ * The extension does not link against Gtk, the functions used here are
+ * looked up once through the typelib of the loaded Gtk namespace and then
+ * called directly. This lets the overrides convert whole rows into a GValue
+ * array in C instead of building a GObject.Value per cell in Python.
+ */
+
+/* Rows with at most this many columns are converted on the stack. */
+#define PYGI_TREE_MODEL_N_STACK_COLUMNS 16
+
+typedef void (*PyGIListStoreInsertFunc) (gpointer store, gpointer iter,
+                                         gint position,
+                                         gint *columns, GValue *values,
+                                         gint n_values);
+typedef void (*PyGITreeStoreInsertFunc) (gpointer store, gpointer iter,
+                                         gpointer parent, gint position,
+                                         gint *columns, GValue *values,
+                                         gint n_values);
+typedef void (*PyGIStoreSetFunc)        (gpointer store, gpointer iter,
+                                         gint *columns, GValue *values,
+                                         gint n_values);
+typedef gint (*PyGIModelGetNColumnsFunc) (gpointer model);
+typedef gboolean (*PyGIModelIterNthChildFunc) (gpointer model, gpointer iter,
+                                               gpointer parent, gint n);
+typedef gboolean (*PyGIModelIterNextFunc) (gpointer model, gpointer iter);
+typedef void (*PyGIModelGetValueFunc)   (gpointer model, gpointer iter,
+                                         gint column, GValue *value);
+
+/* Same layout as GtkTreeIter, used for iters which are not handed back to
+ * Python. */
+typedef struct {
+    gint stamp;
+    gpointer user_data;
+    gpointer user_data2;
+    gpointer user_data3;
+} PyGITreeIter;
+
+static struct {
+    gboolean store_loaded;
+    gboolean model_loaded;
+    GType tree_iter_type;
+    GType list_store_type;
+    GType tree_store_type;
+    PyGIListStoreInsertFunc list_store_insert;
+    PyGITreeStoreInsertFunc tree_store_insert;
+    PyGIStoreSetFunc list_store_set;
+    PyGIStoreSetFunc tree_store_set;
+    GType tree_model_type;
+    PyGIModelGetNColumnsFunc model_get_n_columns;
+    PyGIModelIterNthChildFunc model_iter_nth_child;
+    PyGIModelIterNextFunc model_iter_next;
+    PyGIModelGetValueFunc model_get_value;
+} gtk_store;
+
+static GIBaseInfo *
+_pygi_tree_model_find_info (const gchar *name)
+{
+    GIBaseInfo *info = g_irepository_find_by_name (NULL, "Gtk", name);
+
+    if (info == NULL)
+        PyErr_Format (PyExc_RuntimeError, "Gtk.%s is not available", name);
+    return info;
+}
+
+/* Resolves the C function @symbol from the typelib defining Gtk.@type_name.
+ * Functions are looked up by symbol rather than by method name as several
+ * of them are renamed in the typelib, e.g. gtk_list_store_set_valuesv() is
+ * Gtk.ListStore.set(). */
+static gboolean
+_pygi_tree_model_find_function (const gchar *type_name,
+                                const gchar *symbol,
+                                GType       *g_type,
+                                gpointer    *function)
+{
+    GIBaseInfo *info;
+    gboolean found;
+
+    info = _pygi_tree_model_find_info (type_name);
+    if (info == NULL)
+        return FALSE;
+
+    *g_type = g_registered_type_info_get_g_type ((GIRegisteredTypeInfo *) info);
+    found = g_typelib_symbol (g_base_info_get_typelib (info), symbol, function);
+    g_base_info_unref (info);
+
+    if (!found)
+        PyErr_Format (PyExc_RuntimeError, "could not find %s", symbol);
+    return found;
+}
+
+/* The TreeIter type is needed by both the store and the model helpers. */
+static gboolean
+_pygi_tree_model_load_iter (void)
+{
+    GIBaseInfo *info;
+
+    if (gtk_store.tree_iter_type != G_TYPE_INVALID)
+        return TRUE;
+
+    info = _pygi_tree_model_find_info ("TreeIter");
+    if (info == NULL)
+        return FALSE;
+    gtk_store.tree_iter_type = g_registered_type_info_get_g_type ((GIRegisteredTypeInfo *) info);
+    g_base_info_unref (info);
+
+    return TRUE;
+}
+
+/* The store and the TreeModel functions are loaded separately, so a
+ * missing store function does not break reading other models. */
+static gboolean
+_pygi_tree_model_load_store (void)
+{
+    if (gtk_store.store_loaded)
+        return TRUE;
+
+    if (!_pygi_tree_model_load_iter () ||
+            !_pygi_tree_model_find_function ("ListStore", "gtk_list_store_insert_with_valuesv",
+                                             &gtk_store.list_store_type,
+                                             (gpointer *) &gtk_store.list_store_insert) ||
+            !_pygi_tree_model_find_function ("ListStore", "gtk_list_store_set_valuesv",
+                                             &gtk_store.list_store_type,
+                                             (gpointer *) &gtk_store.list_store_set) ||
+            !_pygi_tree_model_find_function ("TreeStore", "gtk_tree_store_insert_with_valuesv",
+                                             &gtk_store.tree_store_type,
+                                             (gpointer *) &gtk_store.tree_store_insert) ||
+            !_pygi_tree_model_find_function ("TreeStore", "gtk_tree_store_set_valuesv",
+                                             &gtk_store.tree_store_type,
+                                             (gpointer *) &gtk_store.tree_store_set))
+        return FALSE;
+
+    gtk_store.store_loaded = TRUE;
+    return TRUE;
+}
+
+static gboolean
+_pygi_tree_model_load_model (void)
+{
+    if (gtk_store.model_loaded)
+        return TRUE;
+
+    if (!_pygi_tree_model_load_iter () ||
+            !_pygi_tree_model_find_function ("TreeModel", "gtk_tree_model_get_n_columns",
+                                             &gtk_store.tree_model_type,
+                                             (gpointer *) &gtk_store.model_get_n_columns) ||
+            !_pygi_tree_model_find_function ("TreeModel", "gtk_tree_model_iter_nth_child",
+                                             &gtk_store.tree_model_type,
+                                             (gpointer *) &gtk_store.model_iter_nth_child) ||
+            !_pygi_tree_model_find_function ("TreeModel", "gtk_tree_model_iter_next",
+                                             &gtk_store.tree_model_type,
+                                             (gpointer *) &gtk_store.model_iter_next) ||
+            !_pygi_tree_model_find_function ("TreeModel", "gtk_tree_model_get_value",
+                                             &gtk_store.tree_model_type,
+                                             (gpointer *) &gtk_store.model_get_value))
+        return FALSE;
+
+    gtk_store.model_loaded = TRUE;
+    return TRUE;
+}
+
+/* Returns the GtkListStore or GtkTreeStore wrapped by @py_store and whether
+ * it is a tree store, or NULL with an exception set. */
+static GObject *
+_pygi_tree_model_get_store (PyObject *py_store, gboolean *is_tree_store)
+{
+    GObject *store;
+
+    if (!_pygi_tree_model_load_store ())
+        return NULL;
+
+    if (!PyObject_TypeCheck (py_store, &PyGObject_Type)) {
+        PyErr_SetString (PyExc_TypeError, "expected a Gtk.ListStore or Gtk.TreeStore");
+        return NULL;
+    }
+
+    store = pygobject_get (py_store);
+    if (g_type_is_a (G_OBJECT_TYPE (store), gtk_store.tree_store_type)) {
+        *is_tree_store = TRUE;
+    } else if (g_type_is_a (G_OBJECT_TYPE (store), gtk_store.list_store_type)) {
+        *is_tree_store = FALSE;
+    } else {
+        PyErr_SetString (PyExc_TypeError, "expected a Gtk.ListStore or Gtk.TreeStore");
+        return NULL;
+    }
+
+    return store;
+}
+
+static gpointer
+_pygi_tree_model_get_iter (PyObject *py_iter, gboolean allow_none)
+{
+    if (allow_none && py_iter == Py_None)
+        return NULL;
+
+    if (!pyg_boxed_check (py_iter, gtk_store.tree_iter_type)) {
+        PyErr_SetString (PyExc_TypeError, "expected a Gtk.TreeIter");
+        return NULL;
+    }
+
+    return pyg_boxed_get_ptr (py_iter);
+}
+
+static gpointer
+_pygi_tree_model_get_parent (PyObject *py_parent, gboolean is_tree_store)
+{
+    if (py_parent != Py_None && !is_tree_store) {
+        PyErr_SetString (PyExc_TypeError, "list stores have no parent rows");
+        return NULL;
+    }
+
+    return _pygi_tree_model_get_iter (py_parent, TRUE);
+}
+
+/* Conversion state for rows of a store, set up once per call so that
+ * inserting many rows only looks up the column types and their setter
+ * tags once. Small rows live on the stack.
+ */
+typedef struct {
+    gssize n_columns;
+    GType *types;
+    GITypeTag *tags;
+    GValue *values;
+    gint *columns;
+    GType stack_types[PYGI_TREE_MODEL_N_STACK_COLUMNS];
+    GITypeTag stack_tags[PYGI_TREE_MODEL_N_STACK_COLUMNS];
+    GValue stack_values[PYGI_TREE_MODEL_N_STACK_COLUMNS];
+    gint stack_columns[PYGI_TREE_MODEL_N_STACK_COLUMNS];
+} PyGIStoreRow;
+
+static void
+_pygi_store_row_clear (PyGIStoreRow *row)
+{
+    if (row->n_columns > PYGI_TREE_MODEL_N_STACK_COLUMNS) {
+        g_free (row->types);
+        g_free (row->tags);
+        g_free (row->values);
+        g_free (row->columns);
+    }
+}
+
+/* Sets up @row for the sequence of GObject.GType @py_types. Returns FALSE
+ * with an exception set on failure, otherwise @row must be released with
+ * _pygi_store_row_clear(). */
+static gboolean
+_pygi_store_row_init (PyGIStoreRow *row, PyObject *py_types)
+{
+    PyObject *seq;
+    gssize i;
+
+    seq = PySequence_Fast (py_types, "column types must be a sequence");
+    if (seq == NULL)
+        return FALSE;
+
+    row->n_columns = PySequence_Fast_GET_SIZE (seq);
+    if (row->n_columns > PYGI_TREE_MODEL_N_STACK_COLUMNS) {
+        row->types = g_new (GType, row->n_columns);
+        row->tags = g_new (GITypeTag, row->n_columns);
+        row->values = g_new0 (GValue, row->n_columns);
+        row->columns = g_new (gint, row->n_columns);
+    } else {
+        row->types = row->stack_types;
+        row->tags = row->stack_tags;
+        row->values = row->stack_values;
+        row->columns = row->stack_columns;
+        memset (row->stack_values, 0, sizeof (row->stack_values));
+    }
+
+    for (i = 0; i < row->n_columns; i++) {
+        row->types[i] = pyg_type_from_object (PySequence_Fast_GET_ITEM (seq, i));
+        if (row->types[i] == 0) {
+            Py_DECREF (seq);
+            _pygi_store_row_clear (row);
+            return FALSE;
+        }
+        row->tags[i] = pygi_value_get_setter_type_tag (row->types[i]);
+    }
+
+    Py_DECREF (seq);
+    return TRUE;
+}
+
+/* Converts @py_row and inserts it at @position, below @parent for tree
+ * stores. Returns FALSE with an exception set on failure. */
+static gboolean
+_pygi_store_row_insert (PyGIStoreRow *row,
+                        gpointer      store,
+                        gboolean      is_tree_store,
+                        gpointer      iter,
+                        gpointer      parent,
+                        gint          position,
+                        PyObject     *py_row)
+{
+    gssize i, n_values;
+
+    n_values = pygi_value_array_from_row (row->values, row->columns,
+                                          row->types, row->tags,
+                                          row->n_columns, py_row);
+    if (n_values < 0)
+        return FALSE;
+
+    if (is_tree_store)
+        gtk_store.tree_store_insert (store, iter, parent, position,
+                                     row->columns, row->values, n_values);
+    else
+        gtk_store.list_store_insert (store, iter, position,
+                                     row->columns, row->values, n_values);
+
+    for (i = 0; i < n_values; i++)
+        g_value_unset (&row->values[i]);
+
+    return TRUE;
+}
+
+/* _gi.store_insert_row(store, iter, parent, position, row, column_types):
+ *
+ * Inserts @row at @position (below @parent for tree stores) with a single
+ * insert_with_values call and sets @iter to the new row.
+ */
+PyObject *
+_wrap_pygi_store_insert_row (PyObject *self, PyObject *args)
+{
+    PyObject *py_store, *py_iter, *py_parent, *py_row, *py_types;
+    PyGIStoreRow row;
+    gboolean is_tree_store, success;
+    gpointer store, iter, parent;
+    gint position;
+
+    if (!PyArg_ParseTuple (args, "OOOiOO:store_insert_row",
+                           &py_store, &py_iter, &py_parent, &position,
+                           &py_row, &py_types))
+        return NULL;
+
+    store = _pygi_tree_model_get_store (py_store, &is_tree_store);
+    if (store == NULL)
+        return NULL;
+
+    iter = _pygi_tree_model_get_iter (py_iter, FALSE);
+    if (iter == NULL)
+        return NULL;
+
+    parent = _pygi_tree_model_get_parent (py_parent, is_tree_store);
+    if (parent == NULL && PyErr_Occurred ())
+        return NULL;
+
+    if (!_pygi_store_row_init (&row, py_types))
+        return NULL;
+
+    success = _pygi_store_row_insert (&row, store, is_tree_store,
+                                      iter, parent, position, py_row);
+    _pygi_store_row_clear (&row);
+
+    if (!success)
+        return NULL;
+
+    Py_RETURN_NONE;
+}
+
+/* _gi.store_extend(store, parent, rows, column_types):
+ *
+ * Appends every row of the iterable @rows (below @parent for tree stores).
+ * Each row is inserted with a single insert_with_values call, so only
+ * row-inserted is emitted for it. If a row fails to convert, the rows
+ * before it stay in the store and the error is raised.
+ */
+PyObject *
+_wrap_pygi_store_extend (PyObject *self, PyObject *args)
+{
+    PyObject *py_store, *py_parent, *py_rows, *py_types;
+    PyObject *iterator, *py_row;
+    PyGIStoreRow row;
+    PyGITreeIter iter;
+    gboolean is_tree_store;
+    gpointer store, parent;
+
+    if (!PyArg_ParseTuple (args, "OOOO:store_extend",
+                           &py_store, &py_parent, &py_rows, &py_types))
+        return NULL;
+
+    store = _pygi_tree_model_get_store (py_store, &is_tree_store);
+    if (store == NULL)
+        return NULL;
+
+    parent = _pygi_tree_model_get_parent (py_parent, is_tree_store);
+    if (parent == NULL && PyErr_Occurred ())
+        return NULL;
+
+    iterator = PyObject_GetIter (py_rows);
+    if (iterator == NULL)
+        return NULL;
+
+    if (!_pygi_store_row_init (&row, py_types)) {
+        Py_DECREF (iterator);
+        return NULL;
+    }
+
+    while ((py_row = PyIter_Next (iterator)) != NULL) {
+        gboolean success = _pygi_store_row_insert (&row, store, is_tree_store,
+                                                   &iter, parent, -1, py_row);
+        Py_DECREF (py_row);
+        if (!success)
+            break;
+    }
+
+    _pygi_store_row_clear (&row);
+    Py_DECREF (iterator);
+
+    if (PyErr_Occurred ())
+        return NULL;
+
+    Py_RETURN_NONE;
+}
+
+/* _gi.store_set_values(store, iter, columns, values, column_types):
+ *
+ * Sets the given columns of the row at @iter with a single set_valuesv
+ * call. A None value resets the column to the empty value of its type.
+ */
+PyObject *
+_wrap_pygi_store_set_values (PyObject *self, PyObject *args)
+{
+    PyObject *py_store, *py_iter, *py_columns, *py_values, *py_types;
+    PyObject *columns_seq = NULL, *values_seq = NULL;
+    PyGIStoreRow row;
+    GValue stack_values[PYGI_TREE_MODEL_N_STACK_COLUMNS] = { { 0, }, };
+    gint stack_columns[PYGI_TREE_MODEL_N_STACK_COLUMNS];
+    GValue *values = stack_values;
+    gint *columns = stack_columns;
+    gboolean is_tree_store;
+    gpointer store, iter;
+    gssize i, n_values = 0, n_set = 0;
+    PyObject *ret = NULL;
+
+    if (!PyArg_ParseTuple (args, "OOOOO:store_set_values",
+                           &py_store, &py_iter, &py_columns, &py_values,
+                           &py_types))
+        return NULL;
+
+    store = _pygi_tree_model_get_store (py_store, &is_tree_store);
+    if (store == NULL)
+        return NULL;
+
+    iter = _pygi_tree_model_get_iter (py_iter, FALSE);
+    if (iter == NULL)
+        return NULL;
+
+    if (!_pygi_store_row_init (&row, py_types))
+        return NULL;
+
+    columns_seq = PySequence_Fast (py_columns, "columns must be a sequence");
+    if (columns_seq == NULL)
+        goto out;
+    values_seq = PySequence_Fast (py_values, "values must be a sequence");
+    if (values_seq == NULL)
+        goto out;
+
+    n_values = PySequence_Fast_GET_SIZE (columns_seq);
+    if (n_values != PySequence_Fast_GET_SIZE (values_seq)) {
+        PyErr_SetString (PyExc_TypeError,
+                         "The number of columns do not match the number of values");
+        goto out;
+    }
+
+    if (n_values > PYGI_TREE_MODEL_N_STACK_COLUMNS) {
+        values = g_new0 (GValue, n_values);
+        columns = g_new (gint, n_values);
+    }
+
+    for (n_set = 0; n_set < n_values; n_set++) {
+        PyObject *py_column = PySequence_Fast_GET_ITEM (columns_seq, n_set);
+        PyObject *py_value = PySequence_Fast_GET_ITEM (values_seq, n_set);
+        long column;
+
+        if (!PYGLIB_PyLong_Check (py_column)) {
+            PyErr_SetString (PyExc_TypeError,
+                             "TypeError: Expected integer argument for column.");
+            goto out;
+        }
+        column = PYGLIB_PyLong_AsLong (py_column);
+        if (column < 0 || column >= row.n_columns) {
+            PyErr_SetString (PyExc_ValueError, "column number is out of range");
+            goto out;
+        }
+        columns[n_set] = column;
+
+        if (py_value == Py_None) {
+            g_value_init (&values[n_set], row.types[column]);
+        } else if (pygi_value_init_from_py_with_tag (&values[n_set],
+                                                     row.types[column],
+                                                     row.tags[column],
+                                                     py_value) < 0) {
+            goto out;
+        }
+    }
+
+    if (is_tree_store)
+        gtk_store.tree_store_set (store, iter, columns, values, n_values);
+    else
+        gtk_store.list_store_set (store, iter, columns, values, n_values);
+
+    Py_INCREF (Py_None);
+    ret = Py_None;
+
+out:
+    for (i = 0; i < n_set; i++)
+        g_value_unset (&values[i]);
+    if (n_values > PYGI_TREE_MODEL_N_STACK_COLUMNS) {
+        g_free (values);
+        g_free (columns);
+    }
+    Py_XDECREF (columns_seq);
+    Py_XDECREF (values_seq);
+    _pygi_store_row_clear (&row);
+    return ret;
+}
+
+/* Returns the GtkTreeModel wrapped by @py_model, or NULL with an exception
+ * set. */
+static GObject *
+_pygi_tree_model_get_model (PyObject *py_model)
+{
+    if (!_pygi_tree_model_load_model ())
+        return NULL;
+
+    if (!PyObject_TypeCheck (py_model, &PyGObject_Type) ||
+            !g_type_is_a (G_OBJECT_TYPE (pygobject_get (py_model)),
+                          gtk_store.tree_model_type)) {
+        PyErr_SetString (PyExc_TypeError, "expected a Gtk.TreeModel");
+        return NULL;
+    }
+
+    return pygobject_get (py_model);
+}
+
+/* Converts the sequence of column numbers @py_columns, or all columns of
+ * @model if it is None, into a newly allocated array. Returns NULL with an
+ * exception set on failure. */
+static gint *
+_pygi_tree_model_get_columns (gpointer model, PyObject *py_columns,
+                              gssize *n_columns)
+{
+    PyObject *seq;
+    gint *columns;
+    gint i, model_n_columns;
+
+    model_n_columns = gtk_store.model_get_n_columns (model);
+
+    if (py_columns == Py_None) {
+        *n_columns = model_n_columns;
+        columns = g_new (gint, MAX (model_n_columns, 1));
+        for (i = 0; i < model_n_columns; i++)
+            columns[i] = i;
+        return columns;
+    }
+
+    seq = PySequence_Fast (py_columns, "columns must be a sequence");
+    if (seq == NULL)
+        return NULL;
+
+    *n_columns = PySequence_Fast_GET_SIZE (seq);
+    columns = g_new (gint, MAX (*n_columns, 1));
+
+    for (i = 0; i < *n_columns; i++) {
+        PyObject *py_column = PySequence_Fast_GET_ITEM (seq, i);
+        long column;
+
+        if (!PYGLIB_PyLong_Check (py_column)) {
+            PyErr_SetString (PyExc_TypeError, "column numbers must be ints");
+            goto error;
+        }
+        column = PYGLIB_PyLong_AsLong (py_column);
+        if (column < 0 || column >= model_n_columns) {
+            PyErr_SetString (PyExc_ValueError, "column number is out of range");
+            goto error;
+        }
+        columns[i] = column;
+    }
+
+    Py_DECREF (seq);
+    return columns;
+
+error:
+    Py_DECREF (seq);
+    g_free (columns);
+    return NULL;
+}
+
+/* Returns a tuple with the values of @columns in the row at @iter. */
+static PyObject *
+_pygi_tree_model_row_to_tuple (gpointer model, gpointer iter,
+                               const gint *columns, gssize n_columns)
+{
+    PyObject *py_row;
+    gssize i;
+
+    py_row = PyTuple_New (n_columns);
+    if (py_row == NULL)
+        return NULL;
+
+    for (i = 0; i < n_columns; i++) {
+        GValue value = { 0, };
+        PyObject *py_value;
+
+        gtk_store.model_get_value (model, iter, columns[i], &value);
+        /* the value is unset right away, so boxed types must be copied */
+        py_value = pyg_value_as_pyobject (&value, TRUE);
+        g_value_unset (&value);
+
+        if (py_value == NULL) {
+            Py_DECREF (py_row);
+            return NULL;
+        }
+        PyTuple_SET_ITEM (py_row, i, py_value);
+    }
+
+    return py_row;
+}
+
+/* _gi.tree_model_get_values(model, iter, columns):
+ *
+ * Returns a tuple of the values of @columns in the row at @iter.
+ */
+PyObject *
+_wrap_pygi_tree_model_get_values (PyObject *self, PyObject *args)
+{
+    PyObject *py_model, *py_iter, *py_columns, *py_row;
+    gpointer model, iter;
+    gssize n_columns;
+    gint *columns;
+
+    if (!PyArg_ParseTuple (args, "OOO:tree_model_get_values",
+                           &py_model, &py_iter, &py_columns))
+        return NULL;
+
+    model = _pygi_tree_model_get_model (py_model);
+    if (model == NULL)
+        return NULL;
+
+    iter = _pygi_tree_model_get_iter (py_iter, FALSE);
+    if (iter == NULL)
+        return NULL;
+
+    columns = _pygi_tree_model_get_columns (model, py_columns, &n_columns);
+    if (columns == NULL)
+        return NULL;
+
+    py_row = _pygi_tree_model_row_to_tuple (model, iter, columns, n_columns);
+    g_free (columns);
+    return py_row;
+}
+
+/* _gi.tree_model_get_rows(model, parent, columns, start, stop):
+ *
+ * Returns a list with a tuple of the values of @columns (all columns if
+ * None) for the children of @parent from @start up to, but not including,
+ * @stop. The rows are walked with iter_next() instead of looking up
+ * every row by path.
+ */
+PyObject *
+_wrap_pygi_tree_model_get_rows (PyObject *self, PyObject *args)
+{
+    PyObject *py_model, *py_parent, *py_columns, *py_rows;
+    Py_ssize_t start, stop, i;
+    gpointer model, parent;
+    PyGITreeIter iter;
+    gssize n_columns;
+    gint *columns;
+
+    if (!PyArg_ParseTuple (args, "OOOnn:tree_model_get_rows",
+                           &py_model, &py_parent, &py_columns, &start, &stop))
+        return NULL;
+
+    model = _pygi_tree_model_get_model (py_model);
+    if (model == NULL)
+        return NULL;
+
+    parent = _pygi_tree_model_get_iter (py_parent, TRUE);
+    if (parent == NULL && PyErr_Occurred ())
+        return NULL;
+
+    if (start < 0 || start > G_MAXINT) {
+        PyErr_SetString (PyExc_IndexError, "row index is out of bounds");
+        return NULL;
+    }
+
+    columns = _pygi_tree_model_get_columns (model, py_columns, &n_columns);
+    if (columns == NULL)
+        return NULL;
+
+    py_rows = PyList_New (0);
+    if (py_rows == NULL || stop <= start ||
+            !gtk_store.model_iter_nth_child (model, &iter, parent, (gint) start))
+        goto out;
+
+    for (i = start; i < stop; i++) {
+        PyObject *py_row;
+        int ret;
+
+        py_row = _pygi_tree_model_row_to_tuple (model, &iter, columns, n_columns);
+        if (py_row == NULL) {
+            Py_CLEAR (py_rows);
+            break;
+        }
+        ret = PyList_Append (py_rows, py_row);
+        Py_DECREF (py_row);
+        if (ret < 0) {
+            Py_CLEAR (py_rows);
+            break;
+        }
+
+        if (!gtk_store.model_iter_next (model, &iter))
+            break;
+    }
+
+out:
+    g_free (columns);
+    return py_rows;
+}
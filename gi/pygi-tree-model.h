@@ -0,0 +1,43 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PYGI_TREE_MODEL_H__
+#define __PYGI_TREE_MODEL_H__
+
+#include <Python.h>
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+PyObject *_wrap_pygi_store_insert_row (PyObject *self,
+                                       PyObject *args);
+
+PyObject *_wrap_pygi_store_extend     (PyObject *self,
+                                       PyObject *args);
+
+PyObject *_wrap_pygi_store_set_values (PyObject *self,
+                                       PyObject *args);
+
+PyObject *_wrap_pygi_tree_model_get_values (PyObject *self,
+                                             PyObject *args);
+
+PyObject *_wrap_pygi_tree_model_get_rows   (PyObject *self,
+                                             PyObject *args);
+
+G_END_DECLS
+
+#endif /*__PYGI_TREE_MODEL_H__*/
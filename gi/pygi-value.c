@@ -21,6 +21,7 @@
 #include "pygobject-private.h"
 #include "pygtype.h"
 #include "pygparamspec.h"
+#include "pygi-basictype.h"
 
 GIArgument
 _pygi_argument_from_g_value(const GValue *value,
@@ -640,6 +641,234 @@ pyg_value_from_pyobject(GValue *value, PyObject *obj)
     return res;
 }
 
+/**
+ * pygi_value_get_setter_type_tag:
+ * @value_type: a GType
+ *
+ * Maps the fundamental types GObject.Value.set_value() handles with the
+ * introspected g_value_set_*() setters to the tag of their argument.
+ * Callers converting many values of the same type can look the tag up
+ * once and pass it to pygi_value_init_from_py_with_tag().
+ *
+ * Returns: the type tag, or GI_TYPE_TAG_VOID for types converted with
+ *          pyg_value_from_pyobject().
+ */
+GITypeTag
+pygi_value_get_setter_type_tag (GType value_type)
+{
+    switch (G_TYPE_FUNDAMENTAL (value_type)) {
+        case G_TYPE_BOOLEAN:
+            return GI_TYPE_TAG_BOOLEAN;
+        case G_TYPE_CHAR:
+            return GI_TYPE_TAG_INT8;
+        case G_TYPE_UCHAR:
+            return GI_TYPE_TAG_UINT8;
+        case G_TYPE_INT:
+            return GI_TYPE_TAG_INT32;
+        case G_TYPE_UINT:
+            return GI_TYPE_TAG_UINT32;
+        case G_TYPE_LONG:
+            return sizeof (glong) == 8 ? GI_TYPE_TAG_INT64 : GI_TYPE_TAG_INT32;
+        case G_TYPE_ULONG:
+            return sizeof (gulong) == 8 ? GI_TYPE_TAG_UINT64 : GI_TYPE_TAG_UINT32;
+        case G_TYPE_INT64:
+            return GI_TYPE_TAG_INT64;
+        case G_TYPE_UINT64:
+            return GI_TYPE_TAG_UINT64;
+        case G_TYPE_FLOAT:
+            return GI_TYPE_TAG_FLOAT;
+        case G_TYPE_DOUBLE:
+            return GI_TYPE_TAG_DOUBLE;
+        case G_TYPE_STRING:
+            return GI_TYPE_TAG_UTF8;
+        default:
+            return GI_TYPE_TAG_VOID;
+    }
+}
+
+/**
+ * pygi_value_init_from_py_with_tag:
+ * @value: an unset, zero filled GValue
+ * @value_type: type to initialize @value with
+ * @type_tag: pygi_value_get_setter_type_tag() of @value_type
+ * @obj: the Python object to convert
+ *
+ * Initializes @value to @value_type and sets it from @obj the way
+ * GObject.Value(value_type, obj) does, without going through the
+ * introspected setters. A GObject.Value @obj is copied as is, whatever
+ * its type.
+ *
+ * Returns: 0 on success, -1 with an exception set and @value unset.
+ */
+int
+pygi_value_init_from_py_with_tag (GValue    *value,
+                                  GType      value_type,
+                                  GITypeTag  type_tag,
+                                  PyObject  *obj)
+{
+    GIArgument arg;
+    gpointer cleanup_data = NULL;
+
+    if (pyg_boxed_check (obj, G_TYPE_VALUE)) {
+        GValue *src = pyg_boxed_get (obj, GValue);
+
+        g_value_init (value, G_VALUE_TYPE (src));
+        g_value_copy (src, value);
+        return 0;
+    }
+
+    g_value_init (value, value_type);
+
+    if (type_tag == GI_TYPE_TAG_VOID) {
+        if (pyg_value_from_pyobject_with_error (value, obj) < 0) {
+            if (!PyErr_Occurred ())
+                PyErr_Format (PyExc_TypeError, "could not convert %s to %s",
+                              Py_TYPE (obj)->tp_name, g_type_name (value_type));
+            if (G_IS_VALUE (value))
+                g_value_unset (value);
+            return -1;
+        }
+        return 0;
+    }
+
+    if (type_tag == GI_TYPE_TAG_UTF8 &&
+            !PYGLIB_PyUnicode_Check (obj) && !PyUnicode_Check (obj)) {
+        PyErr_Format (PyExc_ValueError, "Expected string but got %s",
+                      Py_TYPE (obj)->tp_name);
+        g_value_unset (value);
+        return -1;
+    }
+
+    if (!_pygi_marshal_from_py_basic_type (obj, &arg, type_tag,
+                                           GI_TRANSFER_EVERYTHING,
+                                           &cleanup_data)) {
+        g_value_unset (value);
+        return -1;
+    }
+
+    switch (G_TYPE_FUNDAMENTAL (value_type)) {
+        case G_TYPE_BOOLEAN:
+            g_value_set_boolean (value, arg.v_boolean);
+            break;
+        case G_TYPE_CHAR:
+            g_value_set_schar (value, arg.v_int8);
+            break;
+        case G_TYPE_UCHAR:
+            g_value_set_uchar (value, arg.v_uint8);
+            break;
+        case G_TYPE_INT:
+            g_value_set_int (value, arg.v_int32);
+            break;
+        case G_TYPE_UINT:
+            g_value_set_uint (value, arg.v_uint32);
+            break;
+        case G_TYPE_LONG:
+            g_value_set_long (value, sizeof (glong) == 8 ? arg.v_int64 : arg.v_int32);
+            break;
+        case G_TYPE_ULONG:
+            g_value_set_ulong (value, sizeof (gulong) == 8 ? arg.v_uint64 : arg.v_uint32);
+            break;
+        case G_TYPE_INT64:
+            g_value_set_int64 (value, arg.v_int64);
+            break;
+        case G_TYPE_UINT64:
+            g_value_set_uint64 (value, arg.v_uint64);
+            break;
+        case G_TYPE_FLOAT:
+            g_value_set_float (value, arg.v_float);
+            break;
+        case G_TYPE_DOUBLE:
+            g_value_set_double (value, arg.v_double);
+            break;
+        case G_TYPE_STRING:
+            g_value_take_string (value, arg.v_string);
+            break;
+    }
+
+    return 0;
+}
+
+/**
+ * pygi_value_init_from_py:
+ * @value: an unset, zero filled GValue
+ * @value_type: type to initialize @value with
+ * @obj: the Python object to convert
+ *
+ * See pygi_value_init_from_py_with_tag().
+ *
+ * Returns: 0 on success, -1 with an exception set and @value unset.
+ */
+int
+pygi_value_init_from_py (GValue *value, GType value_type, PyObject *obj)
+{
+    return pygi_value_init_from_py_with_tag (value, value_type,
+                                             pygi_value_get_setter_type_tag (value_type),
+                                             obj);
+}
+
+/**
+ * pygi_value_array_from_row:
+ * @values: zero filled array of at least @n_columns GValues
+ * @columns: array of at least @n_columns ints, receives the column of
+ *           each converted value
+ * @column_types: the GType of each column
+ * @column_tags: the pygi_value_get_setter_type_tag() of each column
+ * @n_columns: the number of columns
+ * @row: a sequence holding one value per column, None skips a column
+ *
+ * Converts a whole tree model row in one go, see pygi_value_init_from_py().
+ *
+ * Returns: the number of values set, or -1 with an exception set and all
+ *          values unset.
+ */
+gssize
+pygi_value_array_from_row (GValue          *values,
+                           gint            *columns,
+                           const GType     *column_types,
+                           const GITypeTag *column_tags,
+                           gssize           n_columns,
+                           PyObject        *row)
+{
+    PyObject *seq;
+    gssize i, n_values = 0;
+
+    if (PYGLIB_PyUnicode_Check (row)) {
+        PyErr_SetString (PyExc_TypeError, "Expected a list or tuple, but got str");
+        return -1;
+    }
+
+    seq = PySequence_Fast (row, "Expected a list or tuple");
+    if (seq == NULL)
+        return -1;
+
+    if (PySequence_Fast_GET_SIZE (seq) != n_columns) {
+        PyErr_SetString (PyExc_ValueError,
+                         "row sequence has the incorrect number of elements");
+        Py_DECREF (seq);
+        return -1;
+    }
+
+    for (i = 0; i < n_columns; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM (seq, i);
+
+        /* do not try to set None values, they are causing warnings */
+        if (item == Py_None)
+            continue;
+
+        if (pygi_value_init_from_py_with_tag (&values[n_values], column_types[i],
+                                              column_tags[i], item) < 0) {
+            while (n_values > 0)
+                g_value_unset (&values[--n_values]);
+            Py_DECREF (seq);
+            return -1;
+        }
+        columns[n_values++] = i;
+    }
+
+    Py_DECREF (seq);
+    return n_values;
+}
+
 /**
  * pygi_value_to_py_basic_type:
  * @value: the GValue object.
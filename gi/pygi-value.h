@@ -29,6 +29,18 @@ GIArgument _pygi_argument_from_g_value(const GValue *value,
 
 int       pyg_value_from_pyobject(GValue *value, PyObject *obj);
 int       pyg_value_from_pyobject_with_error(GValue *value, PyObject *obj);
+GITypeTag pygi_value_get_setter_type_tag(GType value_type);
+int       pygi_value_init_from_py_with_tag(GValue    *value,
+                                           GType      value_type,
+                                           GITypeTag  type_tag,
+                                           PyObject  *obj);
+int       pygi_value_init_from_py(GValue *value, GType value_type, PyObject *obj);
+gssize    pygi_value_array_from_row(GValue          *values,
+                                    gint            *columns,
+                                    const GType     *column_types,
+                                    const GITypeTag *column_tags,
+                                    gssize           n_columns,
+                                    PyObject        *row);
 PyObject *pyg_value_as_pyobject(const GValue *value, gboolean copy_boxed);
 int       pyg_param_gvalue_from_pyobject(GValue* value,
                                          PyObject* py_obj,
@@ -0,0 +1,941 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pygi-variant.h"
+#include "pygi-array.h"
+#include "pygi-basictype.h"
+#include "pygi-private.h"
+#include "pyglib.h"
+
+/*
+ * Conversion between GVariant trees and Python objects.
+ *
+ * These implement GLib.Variant.unpack() and the GLib.Variant(format, value)
+ * constructor of the GLib overrides. Leaf values go through the same basic
+ * type marshalers as the introspected g_variant_new_*() and
+ * g_variant_get_*() functions so range checks and the resulting Python
+ * types stay identical to calling those one by one.
+ */
+
+static GITypeTag
+_pygi_variant_leaf_type_tag (gchar type_char)
+{
+    switch (type_char) {
+        case 'b':
+            return GI_TYPE_TAG_BOOLEAN;
+        case 'y':
+            return GI_TYPE_TAG_UINT8;
+        case 'n':
+            return GI_TYPE_TAG_INT16;
+        case 'q':
+            return GI_TYPE_TAG_UINT16;
+        case 'i':
+        case 'h':
+            return GI_TYPE_TAG_INT32;
+        case 'u':
+            return GI_TYPE_TAG_UINT32;
+        case 'x':
+            return GI_TYPE_TAG_INT64;
+        case 't':
+            return GI_TYPE_TAG_UINT64;
+        case 'd':
+            return GI_TYPE_TAG_DOUBLE;
+        case 's':
+        case 'o':
+        case 'g':
+            return GI_TYPE_TAG_UTF8;
+        default:
+            return GI_TYPE_TAG_VOID;
+    }
+}
+
+/* Element types g_variant_get_fixed_array() supports, with the struct
+ * module format used for buffers over them.
+ */
+static const gchar *
+_pygi_variant_fixed_format (gchar type_char, gsize *item_size)
+{
+    switch (type_char) {
+        case 'b':
+            *item_size = sizeof (guchar);
+            return "?";
+        case 'y':
+            *item_size = sizeof (guint8);
+            return "B";
+        case 'n':
+            *item_size = sizeof (gint16);
+            return "h";
+        case 'q':
+            *item_size = sizeof (guint16);
+            return "H";
+        case 'i':
+        case 'h':
+            *item_size = sizeof (gint32);
+            return "i";
+        case 'u':
+            *item_size = sizeof (guint32);
+            return "I";
+        case 'x':
+            *item_size = sizeof (gint64);
+            return "q";
+        case 't':
+            *item_size = sizeof (guint64);
+            return "Q";
+        case 'd':
+            *item_size = sizeof (gdouble);
+            return "d";
+        default:
+            return NULL;
+    }
+}
+
+static void
+_pygi_variant_fixed_item_to_arg (gchar type_char, gconstpointer item, GIArgument *arg)
+{
+    switch (type_char) {
+        case 'b':
+            arg->v_boolean = *(const guchar *) item;
+            break;
+        case 'y':
+            arg->v_uint8 = *(const guint8 *) item;
+            break;
+        case 'n':
+            arg->v_int16 = *(const gint16 *) item;
+            break;
+        case 'q':
+            arg->v_uint16 = *(const guint16 *) item;
+            break;
+        case 'i':
+        case 'h':
+            arg->v_int32 = *(const gint32 *) item;
+            break;
+        case 'u':
+            arg->v_uint32 = *(const guint32 *) item;
+            break;
+        case 'x':
+            arg->v_int64 = *(const gint64 *) item;
+            break;
+        case 't':
+            arg->v_uint64 = *(const guint64 *) item;
+            break;
+        case 'd':
+            arg->v_double = *(const gdouble *) item;
+            break;
+    }
+}
+
+static void
+_pygi_variant_free_children (GVariant **children, gsize n_children)
+{
+    gsize i;
+
+    for (i = 0; i < n_children; i++)
+        g_variant_unref (g_variant_ref_sink (children[i]));
+    g_free (children);
+}
+
+/*
+ * GVariant -> Python
+ */
+
+static PyObject *
+_pygi_variant_unpack_leaf (GVariant *variant, gchar type_char)
+{
+    GIArgument arg;
+
+    switch (type_char) {
+        case 'b':
+            arg.v_boolean = g_variant_get_boolean (variant);
+            break;
+        case 'y':
+            arg.v_uint8 = g_variant_get_byte (variant);
+            break;
+        case 'n':
+            arg.v_int16 = g_variant_get_int16 (variant);
+            break;
+        case 'q':
+            arg.v_uint16 = g_variant_get_uint16 (variant);
+            break;
+        case 'i':
+            arg.v_int32 = g_variant_get_int32 (variant);
+            break;
+        case 'h':
+            arg.v_int32 = g_variant_get_handle (variant);
+            break;
+        case 'u':
+            arg.v_uint32 = g_variant_get_uint32 (variant);
+            break;
+        case 'x':
+            arg.v_int64 = g_variant_get_int64 (variant);
+            break;
+        case 't':
+            arg.v_uint64 = g_variant_get_uint64 (variant);
+            break;
+        case 'd':
+            arg.v_double = g_variant_get_double (variant);
+            break;
+        default:
+            arg.v_string = (gchar *) g_variant_get_string (variant, NULL);
+            break;
+    }
+
+    return _pygi_marshal_to_py_basic_type (&arg,
+                                           _pygi_variant_leaf_type_tag (type_char),
+                                           GI_TRANSFER_NOTHING);
+}
+
+static PyObject *
+_pygi_variant_unpack_tuple (GVariant *variant)
+{
+    GVariantIter iter;
+    GVariant *child;
+    PyObject *py_tuple;
+    gsize i = 0;
+
+    py_tuple = PyTuple_New (g_variant_n_children (variant));
+    if (py_tuple == NULL)
+        return NULL;
+
+    g_variant_iter_init (&iter, variant);
+    while ((child = g_variant_iter_next_value (&iter)) != NULL) {
+        PyObject *py_item = pygi_variant_unpack (child);
+
+        g_variant_unref (child);
+        if (py_item == NULL) {
+            Py_DECREF (py_tuple);
+            return NULL;
+        }
+        PyTuple_SET_ITEM (py_tuple, i++, py_item);
+    }
+
+    return py_tuple;
+}
+
+static PyObject *
+_pygi_variant_unpack_fixed_array (GVariant *variant, gchar type_char, gsize item_size)
+{
+    GITypeTag type_tag = _pygi_variant_leaf_type_tag (type_char);
+    const guint8 *data;
+    PyObject *py_list;
+    gsize i, n_items;
+
+    data = g_variant_get_fixed_array (variant, &n_items, item_size);
+
+    py_list = PyList_New (n_items);
+    if (py_list == NULL)
+        return NULL;
+
+    for (i = 0; i < n_items; i++) {
+        GIArgument arg;
+        PyObject *py_item;
+
+        _pygi_variant_fixed_item_to_arg (type_char, data + i * item_size, &arg);
+        py_item = _pygi_marshal_to_py_basic_type (&arg, type_tag, GI_TRANSFER_NOTHING);
+        if (py_item == NULL) {
+            Py_DECREF (py_list);
+            return NULL;
+        }
+        PyList_SET_ITEM (py_list, i, py_item);
+    }
+
+    return py_list;
+}
+
+static PyObject *
+_pygi_variant_unpack_array (GVariant *variant)
+{
+    GVariantIter iter;
+    GVariant *child;
+    PyObject *py_list;
+    gchar element_char = g_variant_get_type_string (variant)[1];
+    gsize i = 0;
+
+    /* arrays of fixed width numbers are read straight from the serialized data */
+    if (_pygi_variant_fixed_format (element_char, &i) != NULL)
+        return _pygi_variant_unpack_fixed_array (variant, element_char, i);
+
+    py_list = PyList_New (g_variant_n_children (variant));
+    if (py_list == NULL)
+        return NULL;
+
+    g_variant_iter_init (&iter, variant);
+    while ((child = g_variant_iter_next_value (&iter)) != NULL) {
+        PyObject *py_item = pygi_variant_unpack (child);
+
+        g_variant_unref (child);
+        if (py_item == NULL) {
+            Py_DECREF (py_list);
+            return NULL;
+        }
+        PyList_SET_ITEM (py_list, i++, py_item);
+    }
+
+    return py_list;
+}
+
+static PyObject *
+_pygi_variant_unpack_dict (GVariant *variant)
+{
+    GVariantIter iter;
+    GVariant *key, *value;
+    PyObject *py_dict;
+
+    py_dict = PyDict_New ();
+    if (py_dict == NULL)
+        return NULL;
+
+    g_variant_iter_init (&iter, variant);
+    while (g_variant_iter_next (&iter, "{@?@*}", &key, &value)) {
+        PyObject *py_key, *py_value = NULL;
+        int res = -1;
+
+        py_key = pygi_variant_unpack (key);
+        if (py_key != NULL)
+            py_value = pygi_variant_unpack (value);
+        if (py_value != NULL)
+            res = PyDict_SetItem (py_dict, py_key, py_value);
+
+        Py_XDECREF (py_key);
+        Py_XDECREF (py_value);
+        g_variant_unref (key);
+        g_variant_unref (value);
+
+        if (res < 0) {
+            Py_DECREF (py_dict);
+            return NULL;
+        }
+    }
+
+    return py_dict;
+}
+
+/**
+ * pygi_variant_unpack:
+ * @variant: a #GVariant
+ *
+ * Recursively converts @variant into native Python objects: containers
+ * become tuples, lists and dicts, boxed variants are unboxed and maybe
+ * types become None or their unpacked value.
+ *
+ * Returns: a new reference or %NULL with an exception set
+ */
+PyObject *
+pygi_variant_unpack (GVariant *variant)
+{
+    const GVariantType *type = g_variant_get_type (variant);
+    gchar type_char = g_variant_get_type_string (variant)[0];
+
+    if (g_variant_type_is_basic (type))
+        return _pygi_variant_unpack_leaf (variant, type_char);
+
+    switch (type_char) {
+        case '(':
+            return _pygi_variant_unpack_tuple (variant);
+
+        case 'a':
+            if (g_variant_type_is_dict_entry (g_variant_type_element (type)))
+                return _pygi_variant_unpack_dict (variant);
+            return _pygi_variant_unpack_array (variant);
+
+        case 'v':
+        {
+            GVariant *child = g_variant_get_variant (variant);
+            PyObject *py_child = pygi_variant_unpack (child);
+
+            g_variant_unref (child);
+            return py_child;
+        }
+
+        case 'm':
+        {
+            GVariant *child = g_variant_get_maybe (variant);
+            PyObject *py_child;
+
+            if (child == NULL)
+                Py_RETURN_NONE;
+
+            py_child = pygi_variant_unpack (child);
+            g_variant_unref (child);
+            return py_child;
+        }
+
+        default:
+            PyErr_Format (PyExc_NotImplementedError,
+                          "unsupported GVariant type %s",
+                          g_variant_get_type_string (variant));
+            return NULL;
+    }
+}
+
+/*
+ * Python -> GVariant
+ *
+ * The creation functions walk the format string through @format and
+ * advance it past the consumed type. When @value is NULL nothing is
+ * created; the type is only parsed, which is needed to find the element
+ * type of empty containers.
+ */
+
+static gboolean
+_pygi_variant_create (const gchar **format,
+                      PyObject     *value,
+                      GVariant    **variant);
+
+static GVariant *
+_pygi_variant_new_leaf (gchar type_char, PyObject *value)
+{
+    GIArgument arg;
+    GITypeTag type_tag = _pygi_variant_leaf_type_tag (type_char);
+    gpointer cleanup_data = NULL;
+    GVariant *variant = NULL;
+
+    if (type_tag == GI_TYPE_TAG_UTF8 && value == Py_None) {
+        PyErr_SetString (PyExc_TypeError, "Must be string, not NoneType");
+        return NULL;
+    }
+
+    if (!_pygi_marshal_from_py_basic_type (value, &arg, type_tag,
+                                           GI_TRANSFER_NOTHING, &cleanup_data))
+        return NULL;
+
+    switch (type_char) {
+        case 'b':
+            return g_variant_new_boolean (arg.v_boolean);
+        case 'y':
+            return g_variant_new_byte (arg.v_uint8);
+        case 'n':
+            return g_variant_new_int16 (arg.v_int16);
+        case 'q':
+            return g_variant_new_uint16 (arg.v_uint16);
+        case 'i':
+            return g_variant_new_int32 (arg.v_int32);
+        case 'h':
+            return g_variant_new_handle (arg.v_int32);
+        case 'u':
+            return g_variant_new_uint32 (arg.v_uint32);
+        case 'x':
+            return g_variant_new_int64 (arg.v_int64);
+        case 't':
+            return g_variant_new_uint64 (arg.v_uint64);
+        case 'd':
+            return g_variant_new_double (arg.v_double);
+        case 's':
+            if (!g_utf8_validate (arg.v_string, -1, NULL)) {
+                PyErr_SetString (PyExc_ValueError, "string is not valid UTF-8");
+                break;
+            }
+            return g_variant_new_take_string (arg.v_string);
+        case 'o':
+            if (!g_variant_is_object_path (arg.v_string)) {
+                PyErr_Format (PyExc_TypeError, "'%s' is not a valid object path",
+                              arg.v_string);
+                break;
+            }
+            variant = g_variant_new_object_path (arg.v_string);
+            break;
+        case 'g':
+            if (!g_variant_is_signature (arg.v_string)) {
+                PyErr_Format (PyExc_TypeError, "'%s' is not a valid signature",
+                              arg.v_string);
+                break;
+            }
+            variant = g_variant_new_signature (arg.v_string);
+            break;
+    }
+
+    g_free (arg.v_string);
+    return variant;
+}
+
+static GVariant *
+_pygi_variant_new_empty_array (const gchar *type_start, const gchar *type_end)
+{
+    gchar *type_string = g_strndup (type_start, type_end - type_start);
+    GVariant *variant = NULL;
+
+    if (g_variant_type_string_is_valid (type_string)) {
+        GVariantType *type = g_variant_type_new (type_string);
+
+        variant = g_variant_new_array (g_variant_type_element (type), NULL, 0);
+        g_variant_type_free (type);
+    } else {
+        PyErr_Format (PyExc_TypeError, "invalid GVariant type string '%s'",
+                      type_string);
+    }
+
+    g_free (type_string);
+    return variant;
+}
+
+static gboolean
+_pygi_variant_create_tuple (const gchar **format,
+                            PyObject     *value,
+                            GVariant    **variant)
+{
+    GVariant **children;
+    Py_ssize_t i, n_children;
+
+    (*format)++;  /* eat the '(' */
+
+    if (value == NULL) {
+        while (**format != ')') {
+            if (**format == '\0') {
+                PyErr_SetString (PyExc_TypeError,
+                                 "tuple type string not closed with )");
+                return FALSE;
+            }
+            if (!_pygi_variant_create (format, NULL, NULL))
+                return FALSE;
+        }
+        (*format)++;  /* eat the ')' */
+        return TRUE;
+    }
+
+    if (!PyTuple_Check (value)) {
+        PyErr_SetString (PyExc_TypeError, "expected tuple argument");
+        return FALSE;
+    }
+
+    n_children = PyTuple_GET_SIZE (value);
+    children = g_new (GVariant *, n_children);
+
+    for (i = 0; i < n_children; i++) {
+        if (**format == ')') {
+            PyErr_SetString (PyExc_TypeError,
+                             "too many arguments for tuple signature");
+            goto err;
+        }
+        if (**format == '\0')
+            break;
+        if (!_pygi_variant_create (format, PyTuple_GET_ITEM (value, i),
+                                   &children[i]))
+            goto err;
+    }
+
+    if (**format != ')') {
+        PyErr_SetString (PyExc_TypeError,
+                         "tuple type string not closed with )");
+        goto err;
+    }
+    (*format)++;  /* eat the ')' */
+
+    *variant = g_variant_new_tuple (children, n_children);
+    g_free (children);
+    return TRUE;
+
+err:
+    _pygi_variant_free_children (children, i);
+    return FALSE;
+}
+
+static GVariant *
+_pygi_variant_create_dict_entry (const gchar **format,
+                                 PyObject     *py_key,
+                                 PyObject     *py_value)
+{
+    GVariant *key, *value;
+
+    if (!_pygi_variant_create (format, py_key, &key))
+        return NULL;
+
+    if (!g_variant_type_is_basic (g_variant_get_type (key))) {
+        PyErr_Format (PyExc_TypeError,
+                      "dictionary key type '%s' is not a basic type",
+                      g_variant_get_type_string (key));
+        g_variant_unref (g_variant_ref_sink (key));
+        return NULL;
+    }
+
+    if (!_pygi_variant_create (format, py_value, &value)) {
+        g_variant_unref (g_variant_ref_sink (key));
+        return NULL;
+    }
+
+    if (**format != '}') {
+        PyErr_SetString (PyExc_TypeError,
+                         "dictionary type string not closed with }");
+        g_variant_unref (g_variant_ref_sink (key));
+        g_variant_unref (g_variant_ref_sink (value));
+        return NULL;
+    }
+    (*format)++;  /* eat the '}' */
+
+    return g_variant_new_dict_entry (key, value);
+}
+
+static gboolean
+_pygi_variant_parse_dict (const gchar **format)
+{
+    *format += 2;  /* eat the 'a{' */
+    if (!_pygi_variant_create (format, NULL, NULL) ||
+            !_pygi_variant_create (format, NULL, NULL))
+        return FALSE;
+
+    if (**format != '}') {
+        PyErr_SetString (PyExc_TypeError,
+                         "dictionary type string not closed with }");
+        return FALSE;
+    }
+    (*format)++;  /* eat the '}' */
+    return TRUE;
+}
+
+static gboolean
+_pygi_variant_create_dict (const gchar **format,
+                           PyObject     *value,
+                           GVariant    **variant)
+{
+    const gchar *type_start = *format;
+    const gchar *entry_format = *format + 2;  /* skip the 'a{' */
+    const gchar *entry_end;
+    GVariant **children;
+    Py_ssize_t n_children = 0;
+    int is_true;
+
+    if (!_pygi_variant_parse_dict (format))
+        return FALSE;
+    if (value == NULL)
+        return TRUE;
+
+    if ((is_true = PyObject_IsTrue (value)) < 0)
+        return FALSE;
+    if (!is_true) {
+        *variant = _pygi_variant_new_empty_array (type_start, *format);
+        return *variant != NULL;
+    }
+
+    if (PyDict_Check (value)) {
+        PyObject *py_key, *py_value;
+        Py_ssize_t pos = 0;
+
+        children = g_new (GVariant *, PyDict_Size (value));
+        while (PyDict_Next (value, &pos, &py_key, &py_value)) {
+            entry_end = entry_format;
+            children[n_children] = _pygi_variant_create_dict_entry (&entry_end,
+                                                                    py_key,
+                                                                    py_value);
+            if (children[n_children] == NULL)
+                goto err;
+            n_children++;
+        }
+    } else {
+        PyObject *py_items, *py_seq;
+        Py_ssize_t i, n_items;
+
+        py_items = PyMapping_Items (value);
+        if (py_items == NULL)
+            return FALSE;
+        py_seq = PySequence_Fast (py_items, "items() must return a sequence");
+        Py_DECREF (py_items);
+        if (py_seq == NULL)
+            return FALSE;
+
+        n_items = PySequence_Fast_GET_SIZE (py_seq);
+        children = g_new (GVariant *, n_items);
+        for (i = 0; i < n_items; i++) {
+            PyObject *py_item = PySequence_Fast_GET_ITEM (py_seq, i);
+
+            if (!PyTuple_Check (py_item) || PyTuple_GET_SIZE (py_item) != 2) {
+                PyErr_SetString (PyExc_TypeError,
+                                 "items() must return (key, value) pairs");
+                Py_DECREF (py_seq);
+                goto err;
+            }
+
+            entry_end = entry_format;
+            children[n_children] = _pygi_variant_create_dict_entry (&entry_end,
+                                                                    PyTuple_GET_ITEM (py_item, 0),
+                                                                    PyTuple_GET_ITEM (py_item, 1));
+            if (children[n_children] == NULL) {
+                Py_DECREF (py_seq);
+                goto err;
+            }
+            n_children++;
+        }
+        Py_DECREF (py_seq);
+    }
+
+    if (n_children == 0)
+        *variant = _pygi_variant_new_empty_array (type_start, *format);
+    else
+        *variant = g_variant_new_array (NULL, children, n_children);
+    g_free (children);
+    return *variant != NULL;
+
+err:
+    _pygi_variant_free_children (children, n_children);
+    return FALSE;
+}
+
+static gboolean
+_pygi_variant_create_array (const gchar **format,
+                            PyObject     *value,
+                            GVariant    **variant)
+{
+    const gchar *type_start = *format;
+    const gchar *element_format = *format + 1;  /* skip the 'a' */
+    const gchar *element_end;
+    GVariant **children;
+    PyObject *py_seq;
+    Py_ssize_t i, n_children;
+    int is_true;
+
+    *format = element_format;
+    if (!_pygi_variant_create (format, NULL, NULL))
+        return FALSE;
+    if (value == NULL)
+        return TRUE;
+
+    if ((is_true = PyObject_IsTrue (value)) < 0)
+        return FALSE;
+    if (!is_true) {
+        *variant = _pygi_variant_new_empty_array (type_start, *format);
+        return *variant != NULL;
+    }
+
+    py_seq = PySequence_Fast (value, "expected a sequence for array type");
+    if (py_seq == NULL)
+        return FALSE;
+
+    n_children = PySequence_Fast_GET_SIZE (py_seq);
+    if (n_children == 0) {
+        Py_DECREF (py_seq);
+        *variant = _pygi_variant_new_empty_array (type_start, *format);
+        return *variant != NULL;
+    }
+
+    children = g_new (GVariant *, n_children);
+    for (i = 0; i < n_children; i++) {
+        element_end = element_format;
+        if (!_pygi_variant_create (&element_end,
+                                   PySequence_Fast_GET_ITEM (py_seq, i),
+                                   &children[i])) {
+            Py_DECREF (py_seq);
+            _pygi_variant_free_children (children, i);
+            return FALSE;
+        }
+    }
+    Py_DECREF (py_seq);
+
+    *variant = g_variant_new_array (NULL, children, n_children);
+    g_free (children);
+    return TRUE;
+}
+
+static gboolean
+_pygi_variant_create (const gchar **format,
+                      PyObject     *value,
+                      GVariant    **variant)
+{
+    gchar type_char = **format;
+
+    if (_pygi_variant_leaf_type_tag (type_char) != GI_TYPE_TAG_VOID) {
+        (*format)++;
+        if (value == NULL)
+            return TRUE;
+        *variant = _pygi_variant_new_leaf (type_char, value);
+        return *variant != NULL;
+    }
+
+    switch (type_char) {
+        case 'v':
+            (*format)++;
+            if (value == NULL)
+                return TRUE;
+            if (!pyg_pointer_check (value, G_TYPE_VARIANT)) {
+                PyErr_Format (PyExc_TypeError,
+                              "expected GLib.Variant, but got %s",
+                              Py_TYPE (value)->tp_name);
+                return FALSE;
+            }
+            *variant = g_variant_new_variant (pyg_pointer_get (value, GVariant));
+            return TRUE;
+
+        case '(':
+            return _pygi_variant_create_tuple (format, value, variant);
+
+        case 'a':
+            if ((*format)[1] == '{')
+                return _pygi_variant_create_dict (format, value, variant);
+            return _pygi_variant_create_array (format, value, variant);
+
+        case '\0':
+            PyErr_SetString (PyExc_TypeError,
+                             "GVariant format string ended unexpectedly");
+            return FALSE;
+
+        default:
+            PyErr_Format (PyExc_NotImplementedError,
+                          "cannot handle GVariant type %s", *format);
+            return FALSE;
+    }
+}
+
+/**
+ * pygi_variant_new:
+ * @format_string: a GVariant type string
+ * @value: a Python object matching @format_string
+ *
+ * Builds a GVariant of type @format_string from @value in a single pass.
+ * Tuples map to tuples, arrays to sequences and dictionaries to mappings;
+ * "v" requires a GLib.Variant.
+ *
+ * Returns: a floating #GVariant or %NULL with an exception set
+ */
+GVariant *
+pygi_variant_new (const gchar *format_string, PyObject *value)
+{
+    const gchar *format = format_string;
+    GVariant *variant = NULL;
+
+    if (!_pygi_variant_create (&format, value, &variant))
+        return NULL;
+
+    if (*format != '\0') {
+        PyErr_Format (PyExc_TypeError,
+                      "invalid remaining format string: \"%s\"", format);
+        g_variant_unref (g_variant_ref_sink (variant));
+        return NULL;
+    }
+
+    return variant;
+}
+
+/*
+ * Buffers
+ */
+
+static const gchar *
+_pygi_variant_fixed_array_format (const gchar *type_string, gsize *item_size)
+{
+    if (type_string[0] != 'a' || type_string[1] == '\0' || type_string[2] != '\0')
+        return NULL;
+
+    return _pygi_variant_fixed_format (type_string[1], item_size);
+}
+
+/**
+ * pygi_variant_to_buffer:
+ * @variant: an array #GVariant of fixed width numbers, e.g. "ay" or "ad"
+ *
+ * Exposes the elements of @variant as a read-only gi.ArrayBuffer without
+ * copying them. The buffer holds a reference on @variant.
+ *
+ * Returns: a new reference or %NULL with an exception set
+ */
+PyObject *
+pygi_variant_to_buffer (GVariant *variant)
+{
+    const gchar *type_string = g_variant_get_type_string (variant);
+    const gchar *format;
+    gconstpointer data;
+    gsize item_size, n_items;
+    PyObject *py_buffer;
+
+    format = _pygi_variant_fixed_array_format (type_string, &item_size);
+    if (format == NULL) {
+        PyErr_Format (PyExc_TypeError,
+                      "expected an array of fixed width numbers, not '%s'",
+                      type_string);
+        return NULL;
+    }
+
+    data = g_variant_get_fixed_array (variant, &n_items, item_size);
+
+    g_variant_ref (variant);
+    py_buffer = pygi_array_buffer_new ((gpointer) data, n_items, item_size,
+                                       format, TRUE,
+                                       (GDestroyNotify) g_variant_unref,
+                                       variant);
+    if (py_buffer == NULL)
+        g_variant_unref (variant);
+
+    return py_buffer;
+}
+
+static void
+_pygi_variant_release_buffer (gpointer data)
+{
+    Py_buffer *view = data;
+    PyGILState_STATE state;
+
+    state = pyglib_gil_state_ensure ();
+    PyBuffer_Release (view);
+    pyglib_gil_state_release (state);
+
+    g_slice_free (Py_buffer, view);
+}
+
+/**
+ * pygi_variant_new_from_buffer:
+ * @type_string: an array type of fixed width numbers, e.g. "ay" or "ad"
+ * @py_buffer: an object supporting the buffer protocol
+ *
+ * Creates an array #GVariant using the memory of @py_buffer as its
+ * serialized data. The exporter of @py_buffer is kept alive (and, for
+ * mutable objects, must not be modified) until the variant is freed.
+ * Memory that is not aligned for the element type is copied once.
+ *
+ * Returns: a floating #GVariant or %NULL with an exception set
+ */
+GVariant *
+pygi_variant_new_from_buffer (const gchar *type_string, PyObject *py_buffer)
+{
+    Py_buffer *view;
+    GVariant *variant;
+    gsize item_size;
+
+    if (_pygi_variant_fixed_array_format (type_string, &item_size) == NULL) {
+        PyErr_Format (PyExc_TypeError,
+                      "expected an array of fixed width numbers, not '%s'",
+                      type_string);
+        return NULL;
+    }
+
+    view = g_slice_new0 (Py_buffer);
+    if (PyObject_GetBuffer (py_buffer, view, PyBUF_SIMPLE) < 0) {
+        g_slice_free (Py_buffer, view);
+        return NULL;
+    }
+
+    if (view->len % item_size != 0) {
+        PyErr_Format (PyExc_ValueError,
+                      "buffer size %" G_GSSIZE_FORMAT " is not a multiple of "
+                      "the element size %" G_GSIZE_FORMAT,
+                      (gssize) view->len, item_size);
+        PyBuffer_Release (view);
+        g_slice_free (Py_buffer, view);
+        return NULL;
+    }
+
+    if (view->len > 0 && GPOINTER_TO_SIZE (view->buf) % item_size == 0) {
+        /* booleans other than 0 and 1 are not in normal form */
+        variant = g_variant_new_from_data (G_VARIANT_TYPE (type_string),
+                                           view->buf, view->len,
+                                           type_string[1] != 'b',
+                                           _pygi_variant_release_buffer,
+                                           view);
+    } else {
+        variant = g_variant_new_fixed_array (G_VARIANT_TYPE (type_string + 1),
+                                             view->buf, view->len / item_size,
+                                             item_size);
+        PyBuffer_Release (view);
+        g_slice_free (Py_buffer, view);
+    }
+
+    return variant;
+}
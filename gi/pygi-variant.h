@@ -0,0 +1,38 @@
+/* -*- Mode: C; c-basic-offset: 4 -*-
+ * vim: tabstop=4 shiftwidth=4 expandtab
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PYGI_VARIANT_H__
+#define __PYGI_VARIANT_H__
+
+#include <Python.h>
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+PyObject *pygi_variant_unpack          (GVariant    *variant);
+
+GVariant *pygi_variant_new             (const gchar *format_string,
+                                        PyObject    *value);
+
+PyObject *pygi_variant_to_buffer       (GVariant    *variant);
+
+GVariant *pygi_variant_new_from_buffer (const gchar *type_string,
+                                        PyObject    *py_buffer);
+
+G_END_DECLS
+
+#endif /*__PYGI_VARIANT_H__*/
@@ -40,6 +40,7 @@ extern GQuark pygboxed_type_key;
 extern GQuark pygboxed_marshal_key;
 extern GQuark pygenum_class_key;
 extern GQuark pygflags_class_key;
+extern GQuark pygenum_value_table_key;
 extern GQuark pyginterface_type_key;
 extern GQuark pyginterface_info_key;
 extern GQuark pygobject_class_init_key;
@@ -49,6 +50,9 @@ extern GQuark pygpointer_class_key;
 extern GQuark pygobject_has_updated_constructor_key;
 extern GQuark pygobject_instance_data_key;
 extern GQuark pygobject_custom_key;
+extern GQuark pygobject_props_cache_key;
+extern GQuark pygobject_property_storage_key;
+extern GQuark pygobject_custom_property_accessors_key;
 
 void     pygobject_data_free  (PyGObjectData *data);
 void     pyg_destroy_notify   (gpointer     user_data);
@@ -108,6 +112,7 @@ PyObject *    pygobject_new_full         (GObject *obj, gboolean steal, gpointer
 void          pygobject_sink             (GObject *obj);
 PyTypeObject *pygobject_lookup_class     (GType gtype);
 void          pygobject_watch_closure    (PyObject *self, GClosure *closure);
+void          pygobject_props_cache_invalidate (GType gtype);
 int           pyg_type_register          (PyTypeObject *class,
 					  const gchar *type_name);
 
@@ -162,6 +167,10 @@ extern PyObject * pyg_enum_add        (PyObject *   module,
 				       GType        gtype);
 extern PyObject * pyg_enum_from_gtype (GType        gtype,
 				       int          value);
+extern PyObject * pyg_enum_value_table_lookup (GType        gtype,
+					       PyObject    *pyclass,
+					       const char  *values_attr,
+					       guint        value);
 
 /* pygtype.c */
 extern gboolean pyg_gtype_is_custom (GType gtype);
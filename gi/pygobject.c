@@ -51,6 +51,9 @@ GQuark pygobject_class_init_key;
 GQuark pygobject_wrapper_key;
 GQuark pygobject_has_updated_constructor_key;
 GQuark pygobject_instance_data_key;
+GQuark pygobject_props_cache_key;
+GQuark pygobject_property_storage_key;
+GQuark pygobject_custom_property_accessors_key;
 
 /* Copied from glib. gobject uses hyphens in property names, but in Python
  * we can only represent hyphens as underscores. Convert underscores to
@@ -248,20 +251,54 @@ build_parameter_list(GObjectClass *class)
     return props_list;
 }
 
-static PyObject*
-PyGProps_getattro(PyGProps *self, PyObject *attr)
+/**
+ * pygobject_props_cache_invalidate:
+ * @gtype: a GType
+ *
+ * Drops the attribute name to GParamSpec cache used by the props
+ * accessor of @gtype. Must be called when properties are installed on
+ * the class after it may have been looked up.
+ **/
+void
+pygobject_props_cache_invalidate(GType gtype)
 {
+    PyObject *cache;
+
+    cache = g_type_get_qdata(gtype, pygobject_props_cache_key);
+    if (cache) {
+        g_type_set_qdata(gtype, pygobject_props_cache_key, NULL);
+        Py_DECREF(cache);
+    }
+}
+
+/* Looks up the GParamSpec of the property @attr refers to on @gtype.
+ * Found pspecs are remembered per GType in a dict keyed by the attribute
+ * string, so repeated access only costs a dict lookup. Returns a borrowed
+ * pspec or NULL if there is no such property, without setting an
+ * exception.
+ */
+static GParamSpec *
+pygobject_props_find_pspec(GType gtype, PyObject *attr)
+{
+    PyObject *cache, *py_pspec;
     char *attr_name, *property_name;
     GObjectClass *class;
     GParamSpec *pspec;
 
+    cache = g_type_get_qdata(gtype, pygobject_props_cache_key);
+    if (cache) {
+        py_pspec = PyDict_GetItem(cache, attr);
+        if (py_pspec)
+            return pyg_param_spec_get(py_pspec);
+    }
+
     attr_name = PYGLIB_PyUnicode_AsString(attr);
     if (!attr_name) {
         PyErr_Clear();
-        return PyObject_GenericGetAttr((PyObject *)self, attr);
+        return NULL;
     }
 
-    class = g_type_class_ref(self->gtype);
+    class = g_type_class_ref(gtype);
 
     /* g_object_class_find_property recurses through the class hierarchy,
      * so the resulting pspec tells us the owner_type that owns the property
@@ -272,6 +309,33 @@ PyGProps_getattro(PyGProps *self, PyObject *attr)
     g_free(property_name);
     g_type_class_unref(class);
 
+    if (!pspec)
+        return NULL;
+
+    if (!cache) {
+        cache = PyDict_New();
+        if (!cache) {
+            PyErr_Clear();
+            return pspec;
+        }
+        g_type_set_qdata(gtype, pygobject_props_cache_key, cache);
+    }
+
+    /* the wrapper keeps the pspec alive as long as it is cached */
+    py_pspec = pyg_param_spec_new(pspec);
+    if (!py_pspec || PyDict_SetItem(cache, attr, py_pspec) < 0)
+        PyErr_Clear();
+    Py_XDECREF(py_pspec);
+
+    return pspec;
+}
+
+static PyObject*
+PyGProps_getattro(PyGProps *self, PyObject *attr)
+{
+    GParamSpec *pspec;
+
+    pspec = pygobject_props_find_pspec(self->gtype, attr);
     if (!pspec) {
 	return PyObject_GenericGetAttr((PyObject *)self, attr);
     }
@@ -331,7 +395,6 @@ static int
 PyGProps_setattro(PyGProps *self, PyObject *attr, PyObject *pvalue)
 {
     GParamSpec *pspec;
-    char *attr_name, *property_name;
     GObject *obj;
     int ret = -1;
     
@@ -341,9 +404,8 @@ PyGProps_setattro(PyGProps *self, PyObject *attr, PyObject *pvalue)
 	return -1;
     }
 
-    attr_name = PYGLIB_PyUnicode_AsString(attr);
-    if (!attr_name) {
-        PyErr_Clear();
+    /* accept unicode names on Python 2 as well */
+    if (!PYGLIB_PyUnicode_Check(attr) && !PyUnicode_Check(attr)) {
         return PyObject_GenericSetAttr((PyObject *)self, attr, pvalue);
     }
 
@@ -355,15 +417,7 @@ PyGProps_setattro(PyGProps *self, PyObject *attr, PyObject *pvalue)
 
     obj = self->pygobject->obj;
 
-    property_name = g_strdup(attr_name);
-    canonicalize_key(property_name);
-
-    /* g_object_class_find_property recurses through the class hierarchy,
-     * so the resulting pspec tells us the owner_type that owns the property
-     * we're dealing with. */
-    pspec = g_object_class_find_property(G_OBJECT_GET_CLASS(obj),
-                                         property_name);
-    g_free(property_name);
+    pspec = pygobject_props_find_pspec(G_OBJECT_TYPE(obj), attr);
     if (!pspec) {
 	return PyObject_GenericSetAttr((PyObject *)self, attr, pvalue);
     }
@@ -1626,7 +1680,7 @@ connect_helper(PyGObject *self, gchar *name, PyObject *callback, PyObject *extra
         /* The signal is implemented by a non-Python class, probably
          * something in the gi repository. */
         closure = pygi_signal_closure_new (self, query_info.itype,
-                                           query_info.signal_name, callback,
+                                           sigid, query_info.signal_name, callback,
                                            extra_args, object);
     }
 
@@ -2338,6 +2392,11 @@ pygobject_object_register_types(PyObject *d)
     pygobject_has_updated_constructor_key =
         g_quark_from_static_string("PyGObject::has-updated-constructor");
     pygobject_instance_data_key = g_quark_from_static_string("PyGObject::instance-data");
+    pygobject_props_cache_key = g_quark_from_static_string("PyGObject::props-cache");
+    pygobject_property_storage_key =
+        g_quark_from_static_string("PyGObject::property-storage");
+    pygobject_custom_property_accessors_key =
+        g_quark_from_static_string("PyGObject::custom-property-accessors");
 
     /* GObject */
     if (!PY_TYPE_OBJECT)
@@ -687,12 +687,15 @@ pyg_closure_marshal(GClosure *closure,
     PyGILState_STATE state;
     PyGClosure *pc = (PyGClosure *)closure;
     PyObject *params, *ret;
+    Py_ssize_t n_extra_args;
     guint i;
 
     state = pyglib_gil_state_ensure();
 
-    /* construct Python tuple for the parameter values */
-    params = PyTuple_New(n_param_values);
+    /* construct Python tuple for the parameter values, leaving room for
+     * the extra arguments so they don't need to be concatenated */
+    n_extra_args = pc->extra_args ? PyTuple_GET_SIZE(pc->extra_args) : 0;
+    params = PyTuple_New(n_param_values + n_extra_args);
     for (i = 0; i < n_param_values; i++) {
 	/* swap in a different initial data for connect_object() */
 	if (i == 0 && G_CCLOSURE_SWAP_DATA(closure)) {
@@ -710,12 +713,13 @@ pyg_closure_marshal(GClosure *closure,
 	}
     }
     /* params passed to function may have extra arguments */
-    if (pc->extra_args) {
-	PyObject *tuple = params;
-	params = PySequence_Concat(tuple, pc->extra_args);
-	Py_DECREF(tuple);
+    for (i = 0; i < n_extra_args; i++) {
+	PyObject *item = PyTuple_GET_ITEM(pc->extra_args, i);
+
+	Py_INCREF(item);
+	PyTuple_SET_ITEM(params, n_param_values + i, item);
     }
-    ret = PyObject_CallObject(pc->callback, params);
+    ret = PyObject_Call(pc->callback, params, NULL);
     if (ret == NULL) {
 	if (pc->exception_handler)
 	    pc->exception_handler(return_value, n_param_values, param_values);
@@ -35,6 +35,8 @@ from ._gi import \
     VFuncInfo, \
     register_interface_info, \
     hook_up_vfunc_implementation, \
+    setup_lazy_methods, \
+    setup_lazy_constants, \
     _gobject
 
 GInterface = _gobject.GInterface
@@ -52,8 +54,9 @@ if (3, 0) <= sys.version_info < (3, 3):
 
 class MetaClassHelper(object):
     def _setup_methods(cls):
-        for method_info in cls.__info__.get_methods():
-            setattr(cls, method_info.__name__, method_info)
+        # Methods are installed as placeholders which turn into the
+        # FunctionInfo on first access.
+        setup_lazy_methods(cls, cls.__info__)
 
     def _setup_class_methods(cls):
         info = cls.__info__
@@ -69,13 +72,10 @@ class MetaClassHelper(object):
     def _setup_fields(cls):
         for field_info in cls.__info__.get_fields():
             name = field_info.get_name().replace('-', '_')
-            setattr(cls, name, property(field_info.get_value, field_info.set_value))
+            setattr(cls, name, field_info)
 
     def _setup_constants(cls):
-        for constant_info in cls.__info__.get_constants():
-            name = constant_info.get_name()
-            value = constant_info.get_value()
-            setattr(cls, name, value)
+        setup_lazy_constants(cls, cls.__info__)
 
     def _setup_vfuncs(cls):
         for vfunc_name, py_vfunc in cls.__dict__.items():
@@ -327,12 +327,10 @@ class StructMeta(type, MetaClassHelper):
         cls._setup_fields()
         cls._setup_methods()
 
-        for method_info in cls.__info__.get_methods():
-            if method_info.is_constructor() and \
-                    method_info.__name__ == 'new' and \
-                    not method_info.get_arguments():
-                cls.__new__ = staticmethod(method_info)
-                break
+        method_info = cls.__info__.find_method('new')
+        if method_info is not None and method_info.is_constructor() and \
+                not method_info.get_arguments():
+            cls.__new__ = staticmethod(method_info)
 
     @property
     def __doc__(cls):
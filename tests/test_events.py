@@ -0,0 +1,88 @@
+# -*- Mode: Python -*-
+
+import socket
+import unittest
+
+from gi.repository import GLib
+
+try:
+    import asyncio
+    from gi.events import GLibEventLoop, GLibEventLoopPolicy
+except ImportError:
+    # gi.events needs Python 3.5.2 for loop.create_future()
+    asyncio = None
+
+
+@unittest.skipUnless(asyncio, 'requires Python 3.5.2 or newer')
+class TestGLibEventLoop(unittest.TestCase):
+    def setUp(self):
+        self.context = GLib.MainContext()
+        self.loop = GLibEventLoop(self.context)
+
+    def tearDown(self):
+        self.loop.close()
+
+    def test_call_soon_and_later(self):
+        calls = []
+        done = self.loop.create_future()
+
+        self.loop.call_later(0.02, lambda: done.set_result(calls))
+        self.loop.call_later(0.01, calls.append, 'later')
+        self.loop.call_soon(calls.append, 'soon')
+
+        self.assertEqual(self.loop.run_until_complete(done), ['soon', 'later'])
+        self.assertFalse(self.loop.is_running())
+
+    def test_reader(self):
+        a, b = socket.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        received = self.loop.create_future()
+
+        def on_readable():
+            self.loop.remove_reader(a.fileno())
+            received.set_result(a.recv(10))
+
+        self.loop.add_reader(a.fileno(), on_readable)
+        self.loop.call_later(0.01, b.send, b'ping')
+        self.assertEqual(self.loop.run_until_complete(received), b'ping')
+
+    def test_run_stop(self):
+        self.loop.call_soon(self.loop.stop)
+        self.loop.run_forever()
+        self.assertFalse(self.loop.is_running())
+
+    def test_shares_main_context(self):
+        # GLib sources run while asyncio runs the context
+        done = self.loop.create_future()
+        source = GLib.Idle()
+        source.set_callback(lambda data: done.set_result('idle'))
+        source.attach(self.context)
+        self.assertEqual(self.loop.run_until_complete(done), 'idle')
+        source.destroy()
+
+        # and asyncio callbacks run while GLib runs the context
+        main_loop = GLib.MainLoop(self.context)
+        self.loop.call_later(0.01, main_loop.quit)
+        main_loop.run()
+
+    def test_task_in_glib_main_loop(self):
+        if not hasattr(asyncio.events, '_get_running_loop'):
+            self.skipTest('no running loop before Python 3.5.3')
+
+        # asyncio.sleep() looks up the running loop
+        main_loop = GLib.MainLoop(self.context)
+        task = self.loop.create_task(asyncio.sleep(0.01, 'slept'))
+        task.add_done_callback(lambda t: main_loop.quit())
+        main_loop.run()
+
+        self.assertEqual(task.result(), 'slept')
+        self.assertFalse(self.loop.is_running())
+
+    def test_policy(self):
+        policy = GLibEventLoopPolicy()
+        loop = policy.new_event_loop()
+        try:
+            self.assertTrue(isinstance(loop, GLibEventLoop))
+        finally:
+            loop.close()
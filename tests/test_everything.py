@@ -7,6 +7,8 @@ import traceback
 import ctypes
 import warnings
 import sys
+import gc
+import gi
 
 try:
     import cairo
@@ -381,6 +383,47 @@ class TestEverything(unittest.TestCase):
     def test_array_int_full_out(self):
         self.assertEqual(Everything.test_array_int_full_out(), [0, 1, 2, 3, 4])
 
+    def test_array_int_full_out_buffer(self):
+        gi.enable_array_buffers('Regress')
+        try:
+            result = Everything.test_array_int_full_out()
+        finally:
+            gi.enable_array_buffers('Regress', False)
+
+        self.assertTrue(isinstance(result, gi._gi.ArrayBuffer))
+        self.assertEqual(len(result), 5)
+        view = memoryview(result)
+        self.assertEqual(view.format, 'i')
+        self.assertEqual(view.tolist(), [0, 1, 2, 3, 4])
+        del view, result
+
+        self.assertEqual(Everything.test_array_int_full_out(), [0, 1, 2, 3, 4])
+
+    def test_gil_policy(self):
+        # accessors keep the GIL, everything else releases it
+        self.assertEqual(gi.get_gil_policy(GLib.MainLoop.is_running), 'keep')
+        self.assertEqual(gi.get_gil_policy(GLib.MainLoop.run), 'release')
+        self.assertEqual(gi.get_gil_policy(Everything.test_int8), 'release')
+
+        loop = GLib.MainLoop()
+        self.assertFalse(loop.is_running())
+        gi.set_gil_policy(GLib.MainLoop.is_running, 'release')
+        try:
+            self.assertEqual(gi.get_gil_policy(loop.is_running), 'release')
+            self.assertFalse(loop.is_running())
+        finally:
+            gi.set_gil_policy(GLib.MainLoop.is_running, None)
+        self.assertEqual(gi.get_gil_policy(GLib.MainLoop.is_running), 'keep')
+
+        gi.set_gil_policy(Everything.test_int8, 'keep')
+        try:
+            self.assertEqual(Everything.test_int8(-42), -42)
+        finally:
+            gi.set_gil_policy(Everything.test_int8, None)
+
+        self.assertRaises(ValueError, gi.set_gil_policy, GLib.MainLoop.run, 'maybe')
+        self.assertRaises(TypeError, gi.get_gil_policy, len)
+
     def test_array_int_none_out(self):
         self.assertEqual(Everything.test_array_int_none_out(), [1, 2, 3, 4, 5])
 
@@ -884,6 +927,37 @@ class TestCallbacks(unittest.TestCase):
         self.assertEqual(sys.getrefcount(callback), callback_refcount)
         self.assertEqual(sys.getrefcount(ud), value_refcount)
 
+    def test_callback_scope_notified_keeps_args(self):
+        # The argument tuple is reused between calls of the same closure,
+        # make sure one held by the callback is left alone.
+        TestCallbacks.args = []
+
+        def callback(*args):
+            TestCallbacks.args.append(args)
+            return 33
+
+        for i in range(3):
+            res = Everything.test_callback_destroy_notify(callback, i, 'x')
+            self.assertEqual(res, 33)
+
+        self.assertEqual(Everything.test_callback_thaw_notifications(), 33 * 3)
+        self.assertEqual(sorted(TestCallbacks.args),
+                         [(0, 'x'), (0, 'x'), (1, 'x'), (1, 'x'), (2, 'x'), (2, 'x')])
+
+    def test_callback_args_tuple_gc(self):
+        # No half cleared argument tuple may be left reachable by the GC
+        # after a callback returned.
+        def callback(*args):
+            return 33
+
+        Everything.test_callback_destroy_notify(callback, 42, 'x')
+        self.assertEqual(Everything.test_callback_thaw_notifications(), 33)
+
+        gc.collect()
+        for obj in gc.get_objects():
+            if isinstance(obj, tuple):
+                repr(obj)
+
     def test_callback_scope_notified_with_destroy_no_user_data(self):
         TestCallbacks.called = 0
 
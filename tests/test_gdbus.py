@@ -96,6 +96,21 @@ class TestGDBusClient(unittest.TestCase):
                              call_done, data)
         main_loop.run()
 
+    def test_proxy_new_without_callback(self):
+        # g_dbus_proxy_new_finish() is a constructor
+        res = Gio.DBusProxy.new(self.bus, Gio.DBusProxyFlags.NONE, None,
+                                'org.freedesktop.DBus',
+                                '/org/freedesktop/DBus',
+                                'org.freedesktop.DBus', None)
+        main_loop = GLib.MainLoop()
+        res.add_done_callback(lambda r: main_loop.quit())
+        main_loop.run()
+
+        self.assertEqual(res.exception(), None)
+        proxy = res.result()
+        self.assertTrue(isinstance(proxy, Gio.DBusProxy))
+        self.assertEqual(proxy.get_name(), 'org.freedesktop.DBus')
+
     def test_python_calls_sync(self):
         # single value return tuples get unboxed to the one element
         result = self.dbus_proxy.ListNames('()')
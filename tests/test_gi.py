@@ -12,6 +12,7 @@ import locale
 import subprocess
 import gc
 import weakref
+import array
 import warnings
 from io import StringIO, BytesIO
 
@@ -757,6 +758,31 @@ class TestArray(unittest.TestCase):
         GIMarshallingTests.array_in_guint64_len(Sequence([-1, 0, 1, 2]))
         GIMarshallingTests.array_in_guint8_len(Sequence([-1, 0, 1, 2]))
 
+    def test_array_in_list_and_tuple(self):
+        GIMarshallingTests.array_in([-1, 0, 1, 2])
+        GIMarshallingTests.array_in((-1, 0, 1, 2))
+        GIMarshallingTests.array_fixed_short_in([-1, 0, 1, 2])
+        GIMarshallingTests.array_uint8_in([97, 98, 99, 100])
+
+    def test_array_in_list_errors(self):
+        self.assertRaises(TypeError, GIMarshallingTests.array_fixed_int_in, [-1, '0', 1, 2])
+        self.assertRaises(ValueError, GIMarshallingTests.array_fixed_int_in, [-1, 0, 1])
+        self.assertRaises(OverflowError, GIMarshallingTests.array_fixed_short_in, [-1, 0, 1, 2 ** 16])
+        self.assertRaises(OverflowError, GIMarshallingTests.array_uint8_in, (97, 98, -1, 100))
+
+    def test_array_in_buffer(self):
+        GIMarshallingTests.array_in(array.array('i', [-1, 0, 1, 2]))
+        GIMarshallingTests.array_fixed_short_in(array.array('h', [-1, 0, 1, 2]))
+        GIMarshallingTests.array_uint8_in(bytearray(_bytes("abcd")))
+        if sys.version_info >= (3, 0):
+            GIMarshallingTests.array_in(memoryview(array.array('i', [-1, 0, 1, 2])))
+
+        # items not matching the C type are converted one by one
+        GIMarshallingTests.array_in(array.array('h', [-1, 0, 1, 2]))
+        GIMarshallingTests.array_in(array.array('l', [-1, 0, 1, 2]))
+        self.assertRaises(ValueError, GIMarshallingTests.array_fixed_short_in,
+                          array.array('h', [-1, 0, 1]))
+
     def test_array_in_len_before(self):
         GIMarshallingTests.array_in_len_before(Sequence([-1, 0, 1, 2]))
 
@@ -1580,6 +1606,11 @@ class TestGEnum(unittest.TestCase):
         self.assertTrue(isinstance(genum, GIMarshallingTests.GEnum))
         self.assertEqual(genum, GIMarshallingTests.GEnum.VALUE3)
 
+    def test_genum_return_cached_instance(self):
+        for i in range(3):
+            genum = GIMarshallingTests.genum_returnv()
+            self.assertTrue(genum is GIMarshallingTests.GEnum.VALUE3)
+
     def test_genum_out(self):
         genum = GIMarshallingTests.genum_out()
         genum = GIMarshallingTests.GEnum.out()
@@ -1629,6 +1660,11 @@ class TestGFlags(unittest.TestCase):
         self.assertTrue(isinstance(flags, GIMarshallingTests.Flags))
         self.assertEqual(flags, GIMarshallingTests.Flags.VALUE2)
 
+    def test_flags_return_cached_instance(self):
+        for i in range(3):
+            flags = GIMarshallingTests.flags_returnv()
+            self.assertTrue(flags is GIMarshallingTests.Flags.VALUE2)
+
     def test_flags_return_method(self):
         flags = GIMarshallingTests.Flags.returnv()
         self.assertTrue(isinstance(flags, GIMarshallingTests.Flags))
@@ -1713,6 +1749,23 @@ class TestStructure(unittest.TestCase):
 
         del struct
 
+    def test_simple_struct_fields(self):
+        field = GIMarshallingTests.SimpleStruct.int8
+        self.assertEqual(field.get_name(), 'int8')
+
+        struct = GIMarshallingTests.SimpleStruct()
+        struct.int8 = -128
+        self.assertEqual(struct.int8, -128)
+        self.assertEqual(field.get_value(struct), -128)
+        field.set_value(struct, 127)
+        self.assertEqual(struct.int8, 127)
+
+        self.assertRaises(ValueError, setattr, struct, 'int8', 128)
+        self.assertRaises(TypeError, setattr, struct, 'int8', 'foo')
+        self.assertEqual(struct.int8, 127)
+        self.assertRaises(AttributeError, delattr, struct, 'int8')
+        self.assertRaises(TypeError, field.get_value, GIMarshallingTests.BoxedStruct())
+
     def test_nested_struct(self):
         struct = GIMarshallingTests.NestedStruct()
 
@@ -1968,6 +2021,19 @@ class TestGObject(unittest.TestCase):
         object_ = GIMarshallingTests.SubObject()
         object_.sub_method()
 
+    def test_sub_object_lazy_method(self):
+        # methods are resolved on first access and replace their
+        # placeholder in the class defining them
+        object_ = GIMarshallingTests.SubObject(int=42)
+        object_.method()
+        self.assertFalse('method' in GIMarshallingTests.SubObject.__dict__)
+        self.assertTrue(isinstance(GIMarshallingTests.Object.__dict__['method'],
+                                   gi._gi.FunctionInfo))
+
+        object_.sub_method()
+        self.assertTrue(isinstance(GIMarshallingTests.SubObject.__dict__['sub_method'],
+                                   gi._gi.FunctionInfo))
+
     def test_sub_object_overwritten_method(self):
         object_ = GIMarshallingTests.SubObject()
         object_.overwritten_method()
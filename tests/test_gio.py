@@ -4,8 +4,16 @@
 import unittest
 
 import gi.overrides
+import gi._gi
 from gi.repository import GLib, Gio
 
+try:
+    import asyncio
+    from gi.events import GLibEventLoop
+except ImportError:
+    # gi.events needs Python 3.5.2 for loop.create_future()
+    asyncio = None
+
 
 class TestGio(unittest.TestCase):
     def test_file_enumerator(self):
@@ -202,6 +210,75 @@ class TestGFile(unittest.TestCase):
         main_loop.run()
         self.assertFalse(self.file.query_exists(None))
 
+    def test_async_without_callback(self):
+        self.file.replace_contents(b'hello', None, False,
+                                   Gio.FileCreateFlags.NONE, None)
+
+        res = self.file.load_contents_async(None)
+        self.assertTrue(isinstance(res, gi._gi.Async))
+        self.assertFalse(res.done())
+        # awaiting a pending result yields the result itself
+        self.assertTrue(next(res.__await__()) is res)
+
+        main_loop = GLib.MainLoop()
+        res.add_done_callback(lambda r: main_loop.quit())
+        main_loop.run()
+
+        self.assertTrue(res.done())
+        self.assertEqual(res.exception(), None)
+        succ, content, etag = res.result()
+        self.assertTrue(succ)
+        self.assertEqual(content, b'hello')
+
+        try:
+            next(res.__await__())
+        except StopIteration as e:
+            self.assertEqual(e.args[0], res.result())
+        else:
+            self.fail('StopIteration not raised')
+
+    def test_async_without_callback_error(self):
+        self.file.delete(None)
+
+        res = self.file.load_contents_async(None)
+        main_loop = GLib.MainLoop()
+        res.add_done_callback(lambda r: main_loop.quit())
+        main_loop.run()
+
+        self.assertTrue(isinstance(res.exception(), GLib.GError))
+        self.assertRaises(GLib.GError, res.result)
+
+    def test_async_cancel(self):
+        cancellable = Gio.Cancellable()
+        res = self.file.load_contents_async(cancellable)
+        self.assertTrue(res.cancellable is not None)
+
+        self.assertTrue(res.cancel())
+        self.assertTrue(cancellable.is_cancelled())
+        self.assertTrue(res.done())
+        self.assertTrue(res.cancelled())
+
+        # let the operation finish
+        context = GLib.MainContext.default()
+        while context.pending():
+            context.iteration(False)
+
+    @unittest.skipUnless(asyncio, 'requires Python 3.5.2 or newer')
+    def test_async_asyncio(self):
+        self.file.replace_contents(b'hello', None, False,
+                                   Gio.FileCreateFlags.NONE, None)
+        loop = GLibEventLoop()
+        self.addCleanup(loop.close)
+        done = loop.create_future()
+
+        def start():
+            res = self.file.load_contents_async(None)
+            self.assertTrue(res.get_loop() is loop)
+            res.add_done_callback(lambda r: done.set_result(r.result()[1]))
+
+        loop.call_soon(start)
+        self.assertEqual(loop.run_until_complete(done), b'hello')
+
 
 class TestGApplication(unittest.TestCase):
     def test_command_line(self):
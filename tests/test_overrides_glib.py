@@ -2,6 +2,7 @@
 # vim: tabstop=4 shiftwidth=4 expandtab
 
 import gc
+import struct
 import unittest
 
 import gi
@@ -287,6 +288,47 @@ class TestGVariant(unittest.TestCase):
         res = v.unpack()
         self.assertEqual(res, None)
 
+    def test_create_unpack_roundtrip(self):
+        obj = dict(('key%i' % i, GLib.Variant('(ids)', (i, i / 2.0, str(i))))
+                   for i in range(1000))
+        variant = GLib.Variant('a{sv}', obj)
+        self.assertEqual(variant.get_type_string(), 'a{sv}')
+        self.assertEqual(variant.n_children(), 1000)
+        res = variant.unpack()
+        self.assertEqual(len(res), 1000)
+        self.assertEqual(res['key42'], (42, 21.0, '42'))
+
+        # values are range checked like the new_*() constructors
+        self.assertRaises(OverflowError, GLib.Variant, 'y', 256)
+        self.assertRaises(OverflowError, GLib.Variant, '(n)', (1 << 15,))
+        self.assertRaises(TypeError, GLib.Variant, 'v', 1)
+        self.assertRaises(TypeError, GLib.Variant, 'a{(ii)i}', {(1, 2): 3})
+
+    def test_fixed_array_buffer(self):
+        variant = GLib.Variant('ai', [1, -2, 3])
+        buf = variant.get_buffer()
+        del variant
+        gc.collect()
+        view = memoryview(buf)
+        self.assertEqual(view.format, 'i')
+        self.assertEqual(struct.unpack('=3i', view.tobytes()), (1, -2, 3))
+        self.assertTrue(view.readonly)
+
+        self.assertEqual(memoryview(GLib.Variant('ay', []).get_buffer()).tobytes(), b'')
+        self.assertRaises(TypeError, GLib.Variant('as', []).get_buffer)
+
+    def test_new_from_buffer(self):
+        data = struct.pack('=3d', 1.5, -2.0, 3.25)
+        variant = GLib.Variant.new_from_buffer('ad', data)
+        self.assertEqual(variant.get_type_string(), 'ad')
+        self.assertEqual(variant.unpack(), [1.5, -2.0, 3.25])
+
+        variant = GLib.Variant.new_from_buffer('ay', b'\x01\x02\xff')
+        self.assertEqual(variant.unpack(), [1, 2, 255])
+
+        self.assertRaises(ValueError, GLib.Variant.new_from_buffer, 'ai', b'\x01\x02')
+        self.assertRaises(TypeError, GLib.Variant.new_from_buffer, 'as', b'')
+
     def test_iteration(self):
         # array index access
         vb = GLib.VariantBuilder.new(gi._gi.variant_type_from_string('ai'))
@@ -1317,6 +1317,60 @@ class TestTreeModel(unittest.TestCase):
         list_store.insert(1)
         self.assertEqual(signals, ['row-inserted'])
 
+    def test_list_store_set_signals(self):
+        list_store = Gtk.ListStore(int, str, float, bool)
+        treeiter = list_store.append((0, 'zero', 0.0, False))
+
+        signals = []
+        list_store.connect('row-changed', lambda *args: signals.append('row-changed'))
+
+        # setting several columns at once should only change the row once
+        list_store.set(treeiter, 0, 1, 1, 'one', 2, 1.5, 3, True)
+        self.assertEqual(signals, ['row-changed'])
+        self.assertEqual(tuple(list_store[0]), (1, 'one', 1.5, True))
+
+        signals.pop()
+        list_store.set(treeiter, {0: 2, 3: False})
+        self.assertEqual(signals, ['row-changed'])
+        self.assertEqual(tuple(list_store[0]), (2, 'one', 1.5, False))
+
+        self.assertRaises(ValueError, list_store.set, treeiter, 4, 0)
+        self.assertRaises(ValueError, list_store.set_value, treeiter, 1, 3)
+        self.assertRaises(TypeError, list_store.append, (0, 'zero', 'foo', False))
+        self.assertEqual(len(list_store), 1)
+
+    def test_list_store_extend(self):
+        list_store = Gtk.ListStore(int, str)
+        list_store.append((0, 'zero'))
+
+        signals = []
+        list_store.connect('row-inserted', lambda *args: signals.append('row-inserted'))
+        list_store.connect('row-changed', lambda *args: signals.append('row-changed'))
+
+        list_store.extend((i, str(i)) for i in range(1, 4))
+        self.assertEqual(signals, ['row-inserted'] * 3)
+        self.assertEqual([tuple(row) for row in list_store],
+                         [(0, 'zero'), (1, '1'), (2, '2'), (3, '3')])
+
+        # None skips a column, rows before a bad one are kept
+        self.assertRaises(ValueError, list_store.extend, [(4, None), (5,)])
+        self.assertEqual(len(list_store), 5)
+        self.assertEqual(list_store[4][0], 4)
+        self.assertEqual(list_store[4][1], None)
+
+    def test_tree_store_extend(self):
+        tree_store = Gtk.TreeStore(int, str)
+        parent = tree_store.append(None, (0, 'parent'))
+
+        tree_store.extend(parent, [(1, 'one'), [2, 'two']])
+        tree_store.extend(None, [(3, 'three')])
+        self.assertEqual(len(tree_store), 2)
+        self.assertEqual([tuple(row) for row in tree_store[0].iterchildren()],
+                         [(1, 'one'), (2, 'two')])
+        self.assertEqual(tuple(tree_store[1]), (3, 'three'))
+
+        self.assertRaises(TypeError, Gtk.ListStore(int).extend, 'a')
+
     def test_tree_path(self):
         p1 = Gtk.TreePath()
         p2 = Gtk.TreePath.new_first()
@@ -1523,6 +1577,32 @@ class TestTreeModel(unittest.TestCase):
         self.assertRaises(IndexError, tree_store.__delitem__, -101)
         self.assertRaises(IndexError, tree_store.__delitem__, 101)
 
+    def test_tree_model_get_rows(self):
+        list_store = Gtk.ListStore(int, str, bool)
+        list_store.extend((i, 'row %d' % i, i % 2 == 0) for i in range(25))
+
+        rows = list_store.get_rows()
+        self.assertEqual(len(rows), 25)
+        self.assertEqual(rows[3], (3, 'row 3', False))
+
+        self.assertEqual(list_store.get_rows([2, 0], 5, 8),
+                         [(False, 5), (True, 6), (False, 7)])
+        self.assertEqual(list_store.get_rows([0], -2), [(23,), (24,)])
+        self.assertEqual(list_store.get_rows([0], 30), [])
+        self.assertEqual(list_store.get_rows([], 0, 2), [(), ()])
+        self.assertRaises(TypeError, list_store.get_rows, ['a'])
+        self.assertRaises(ValueError, list_store.get_rows, [3])
+
+        self.assertEqual(list(list_store.iter_rows([0], batch_size=10)),
+                         [(i,) for i in range(25)])
+        self.assertEqual(list_store[4][1:], ['row 4', True])
+
+        tree_store = Gtk.TreeStore(int)
+        parent = tree_store.append(None, (0,))
+        tree_store.extend(parent, [(1,), (2,)])
+        self.assertEqual(tree_store.get_rows(parent=parent), [(1,), (2,)])
+        self.assertEqual(list(tree_store.iter_rows(parent=parent)), [(1,), (2,)])
+
     def test_tree_model_get_iter_fail(self):
         # TreeModel class with a failing get_iter()
         class MyTreeModel(GObject.GObject, Gtk.TreeModel):
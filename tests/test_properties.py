@@ -108,6 +108,23 @@ class TestPropertyInheritanceObject(unittest.TestCase):
         obj.props.python_prop = 5
         self.assertEqual(obj.props.python_prop, 5)
 
+    def test_override_python_property_repeated_access(self):
+        # the name lookup is cached per GType, so the base class and the
+        # subclass must keep resolving to their own pspecs
+        base = PropertyInheritanceObject()
+        sub = PropertySubClassObject()
+        for i in range(3):
+            base.props.python_prop = str(i)
+            sub.props.python_prop = i
+            self.assertEqual(base.props.python_prop, str(i))
+            self.assertEqual(sub.props.python_prop, i)
+        setattr(base.props, u'python_prop', 'x')
+        self.assertEqual(base.props.python_prop, 'x')
+        self.assertEqual(PropertyInheritanceObject.props.python_prop.value_type,
+                         TYPE_STRING)
+        self.assertEqual(PropertySubClassObject.props.python_prop.value_type,
+                         TYPE_INT)
+
 
 class TestPropertyObject(unittest.TestCase):
     def test_get_set(self):
@@ -880,6 +897,65 @@ class TestProperty(unittest.TestCase):
         self.assertRaises(TypeError, tester._type_from_python, types.CodeType)
 
 
+class TestPropertyNativeStorage(unittest.TestCase):
+    class Native(GObject.Object):
+        count = GObject.Property(type=int, default=3)
+        label = GObject.Property(type=str)
+
+    class CustomAccessors(Native):
+        def do_get_property(self, pspec):
+            if pspec.name == 'count':
+                return 42
+            return super(TestPropertyNativeStorage.CustomAccessors,
+                         self).do_get_property(pspec)
+
+    def test_default(self):
+        obj = self.Native()
+        self.assertEqual(obj.count, 3)
+        self.assertEqual(obj.get_property('count'), 3)
+        self.assertEqual(obj.label, None)
+
+    def test_python_and_gobject_access_agree(self):
+        obj = self.Native()
+        obj.count = 5
+        self.assertEqual(obj.get_property('count'), 5)
+        obj.set_property('label', 'foo')
+        self.assertEqual(obj.label, 'foo')
+        self.assertEqual(obj.props.label, 'foo')
+
+    def test_notify_and_binding(self):
+        source = self.Native()
+        target = self.Native()
+        notified = []
+        source.connect('notify::count', lambda obj, pspec: notified.append(obj.count))
+        source.bind_property('count', target, 'count')
+        source.count = 7
+        self.assertEqual(notified, [7])
+        self.assertEqual(target.count, 7)
+
+    def test_access_before_init(self):
+        class Early(self.Native):
+            def __init__(self):
+                # reads the default, writing needs an initialized object
+                self.early_count = self.count
+                try:
+                    self.count = 1
+                except TypeError:
+                    self.early_set_failed = True
+                super(Early, self).__init__()
+
+        obj = Early()
+        self.assertEqual(obj.early_count, 3)
+        self.assertTrue(obj.early_set_failed)
+        self.assertEqual(obj.count, 3)
+
+    def test_subclass_custom_accessors_are_used(self):
+        obj = self.CustomAccessors()
+        self.assertEqual(obj.get_property('count'), 42)
+        obj.label = 'bar'
+        self.assertEqual(obj.get_property('label'), 'bar')
+
+
 class TestInstallProperties(unittest.TestCase):
     # These tests only test how signalhelper.install_signals works
     # with the __gsignals__ dict and therefore does not need to use
@@ -1114,6 +1190,21 @@ class CPropertiesTestBase(object):
         obj = GIMarshallingTests.PropertiesObject(some_boxed_struct=struct1)
         self.assertEqual(self.get_prop(obj, 'some-boxed-struct').long_, 1)
 
+    def test_boxed_struct_repeated_access(self):
+        # the property introspection data is looked up once and shared by
+        # all instances
+        obj = GIMarshallingTests.PropertiesObject()
+        for i in range(3):
+            struct1 = GIMarshallingTests.BoxedStruct()
+            struct1.long_ = i
+            struct2 = GIMarshallingTests.BoxedStruct()
+            struct2.long_ = i + 10
+
+            self.set_prop(self.obj, 'some-boxed-struct', struct1)
+            self.set_prop(obj, 'some-boxed-struct', struct2)
+            self.assertEqual(self.get_prop(self.obj, 'some-boxed-struct').long_, i)
+            self.assertEqual(self.get_prop(obj, 'some-boxed-struct').long_, i + 10)
+
     def test_boxed_glist(self):
         self.assertEqual(self.get_prop(self.obj, 'some-boxed-glist'), [])
 
@@ -71,6 +71,20 @@ class Test(unittest.TestCase):
         self.assertEqual(arg.get_scope(), GIRepository.ScopeType.INVALID)
         self.assertEqual(arg.get_type().get_tag(), GIRepository.TypeTag.ARRAY)
 
+    def test_build_index(self):
+        info = repo.find_by_name('GIMarshallingTests', 'Object')
+        repo.build_index('GIMarshallingTests')
+        self.assertEqual(repo.find_by_name('GIMarshallingTests', 'Object'), info)
+        self.assertEqual(repo.find_by_name('GIMarshallingTests', 'int8_in_max').get_name(),
+                         'int8_in_max')
+        self.assertEqual(repo.find_by_name('GIMarshallingTests', 'NotAName'), None)
+        # building it again is a no-op
+        repo.build_index('GIMarshallingTests')
+        self.assertEqual(repo.find_by_name('GIMarshallingTests', 'Object'), info)
+
+    def test_build_index_not_loaded(self):
+        self.assertRaises(RuntimeError, repo.build_index, 'NotANamespace')
+
     def test_base_info(self):
         info = repo.find_by_name('GIMarshallingTests', 'Object')
         self.assertEqual(info.__name__, 'Object')
@@ -1133,6 +1133,38 @@ class TestIntrospectedSignals(unittest.TestCase):
         self.assertEqual(rv, GObject.G_MAXINT64)
         self.assertEqual(obj.callback_i, GObject.G_MAXINT64)
 
+    def test_int64_param_repeated_emission(self):
+        obj = Regress.TestObj()
+        received = []
+
+        def callback(obj, i):
+            received.append(i)
+            return i
+
+        obj.connect('sig-with-int64-prop', callback)
+        obj.connect('sig-with-int64-prop', callback)
+        for i in range(3):
+            self.assertEqual(obj.emit('sig-with-int64-prop', i), i)
+        self.assertEqual(received, [0, 0, 1, 1, 2, 2])
+
+    def test_many_instances_connected(self):
+        received = []
+
+        def callback(obj, i):
+            received.append((obj, i))
+            return i
+
+        objs = [Regress.TestObj() for i in range(5)]
+        handlers = [obj.connect('sig-with-int64-prop', callback) for obj in objs]
+        for i, obj in enumerate(objs):
+            obj.emit('sig-with-int64-prop', i)
+        self.assertEqual(received, list(zip(objs, range(5))))
+
+        for obj, handler in zip(objs, handlers):
+            obj.disconnect(handler)
+        objs[0].emit('sig-with-int64-prop', 42)
+        self.assertEqual(len(received), 5)
+
     def test_uint64_param_from_py(self):
         obj = Regress.TestObj()
 
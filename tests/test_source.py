@@ -1,6 +1,8 @@
 # -*- Mode: Python -*-
 
 import gc
+import sys
+import threading
 import unittest
 import warnings
 
@@ -224,6 +226,31 @@ class TestSource(unittest.TestCase):
         del source
         self.assertTrue(self.finalized)
 
+    def test_default_prepare_check(self):
+        self.dispatched = 0
+
+        class S(GLib.Source):
+            def dispatch(s, callback, args):
+                self.dispatched += 1
+                s.set_ready_time(-1)
+                return True
+
+        context = GLib.MainContext()
+        source = S()
+        self.assertEqual(source.prepare(), False)
+        self.assertEqual(source.check(), False)
+        source.attach(context)
+
+        # nothing to do without a ready time
+        self.assertFalse(context.iteration(False))
+        self.assertEqual(self.dispatched, 0)
+
+        source.set_ready_time(0)
+        while context.iteration(False):
+            pass
+        self.assertEqual(self.dispatched, 1)
+        source.destroy()
+
     @unittest.skip('https://bugzilla.gnome.org/show_bug.cgi?id=722387')
     def test_python_unref_with_active_source(self):
         # Tests a Python derived Source which is free'd in the context of
@@ -424,5 +451,105 @@ class TestUserData(unittest.TestCase):
         self.assertTrue(data['called'])
 
 
+class TestCallQueue(unittest.TestCase):
+    def setUp(self):
+        self.context = GLib.MainContext()
+        self.queue = GLib.CallQueue(self.context)
+
+    def tearDown(self):
+        self.queue.close()
+
+    def run_pending(self):
+        n_iterations = 0
+        while self.context.iteration(False):
+            n_iterations += 1
+        return n_iterations
+
+    def test_batch(self):
+        calls = []
+        for i in range(100):
+            self.queue.call(calls.append, i)
+        self.assertEqual(calls, [])
+
+        # all calls run in a single dispatch
+        self.assertEqual(self.run_pending(), 1)
+        self.assertEqual(calls, list(range(100)))
+
+        self.assertEqual(self.run_pending(), 0)
+        self.queue.call(calls.append, 100)
+        self.run_pending()
+        self.assertEqual(calls[-1], 100)
+
+    def test_coalesced(self):
+        calls = []
+        self.queue.call(calls.append, 'a')
+        self.queue.call_coalesced('key', calls.append, 1)
+        self.queue.call(calls.append, 'b')
+        self.queue.call_coalesced('key', calls.append, 2)
+        self.queue.call_coalesced('other', calls.append, 'c')
+        self.run_pending()
+        self.assertEqual(calls, ['a', 2, 'b', 'c'])
+
+        self.queue.call_coalesced('key', calls.append, 3)
+        self.run_pending()
+        self.assertEqual(calls[-1], 3)
+
+    def test_threads(self):
+        calls = []
+        loop = GLib.MainLoop(self.context)
+
+        def post(n):
+            for i in range(n):
+                self.queue.call(calls.append, i)
+            self.queue.call(finished.append, n)
+
+        def check_finished():
+            if len(finished) == len(threads):
+                loop.quit()
+
+        finished = []
+        threads = [threading.Thread(target=post, args=(1000,)) for i in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.queue.call(check_finished)
+        loop.run()
+
+        self.assertEqual(len(calls), 4000)
+
+    def test_exception(self):
+        calls = []
+
+        def fail():
+            raise ValueError('expected')
+
+        old_excepthook = sys.excepthook
+        sys.excepthook = lambda *args: calls.append(args[0])
+        try:
+            self.queue.call(fail)
+            self.queue.call(calls.append, 'next')
+            self.run_pending()
+        finally:
+            sys.excepthook = old_excepthook
+
+        self.assertEqual(calls, [ValueError, 'next'])
+
+    def test_close_in_callback(self):
+        calls = []
+        self.queue.call(calls.append, 'a')
+        self.queue.call(self.queue.close)
+        self.queue.call(calls.append, 'b')
+        self.queue.call_coalesced('key', calls.append, 'c')
+        self.run_pending()
+        self.assertEqual(calls, ['a'])
+
+        self.assertRaises(RuntimeError, self.queue.call, calls.append, 'd')
+        self.assertRaises(RuntimeError, self.queue.call_coalesced,
+                          'key', calls.append, 'e')
+        self.assertEqual(self.run_pending(), 0)
+        self.assertEqual(calls, ['a'])
+
+
 if __name__ == '__main__':
     unittest.main()